@@ -110,6 +110,8 @@ enum
     ID_DATABASE_APPEND,
     ID_DATABASE_PATTERN,
     ID_DATABASE_MATERIAL,
+    ID_DATABASE_NOVELTY,
+    ID_DATABASE_REPERTOIRE,
     ID_DATABASE_MAINTENANCE,
     ID_GAMES_CURRENT,
     ID_GAMES_DATABASE,
@@ -35,7 +35,6 @@ void Pgn2Tdb( FILE *fin, FILE *fout );
 void Tdb2Pgn( const char *infile, const char *outfile );
 void Tdb2Pgn( FILE *fin, FILE *fout );
 
-int BitsRequired( int max );
 void ReadStrings( FILE *fin, int nbr_strings, std::vector<std::string> &strings );
 
 #endif  // BINDB_H
@@ -31,4 +31,7 @@ void Bin2Result( uint32_t bin, std::string &result );
 uint16_t Elo2Bin( const char *elo );
 void Bin2Elo( uint32_t bin, std::string &elo );
 
+// Bits needed to store values 0..max-1 (at least 1, at most 24)
+int BitsRequired( int max );
+
 #endif  // BINARY_CONVERSIONS_H
@@ -0,0 +1,1002 @@
+/****************************************************************************
+ * Bitboard chess position and legal move generator, an optional faster
+ *  alternative to thc::ChessRules for hot paths that generate whole move lists
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <vector>
+#include <chrono>
+#include "DebugPrintf.h"
+#include "BitboardPosition.h"
+#if defined(__BMI2__)
+#include <immintrin.h>
+#define BB_USE_PEXT
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#define BIT(sq) (1ULL<<(sq))
+
+static inline int PopCount( uint64_t b )
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>( __popcnt64(b) );
+#elif defined(_MSC_VER)
+    int n = 0;
+    while( b )
+    {
+        b &= b-1;
+        n++;
+    }
+    return n;
+#else
+    return __builtin_popcountll(b);
+#endif
+}
+
+static inline int Lsb( uint64_t b )
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanForward64( &idx, b );
+    return static_cast<int>(idx);
+#elif defined(_MSC_VER)
+    unsigned long idx;
+    if( _BitScanForward( &idx, static_cast<unsigned long>(b) ) )
+        return static_cast<int>(idx);
+    _BitScanForward( &idx, static_cast<unsigned long>(b>>32) );
+    return static_cast<int>(idx) + 32;
+#else
+    return __builtin_ctzll(b);
+#endif
+}
+
+static inline int PopLsb( uint64_t &b )
+{
+    int sq = Lsb(b);
+    b &= b-1;
+    return sq;
+}
+
+// Sliding piece attacks for one square, indexed by the relevant occupancy
+struct SliderEntry
+{
+    uint64_t        mask;       // relevant occupancy, rays without their final square
+    uint64_t        magic;
+    const uint64_t *attacks;
+    int             shift;
+};
+
+// Directions are (row,file) steps, row 0 is the eighth rank as with thc::Square
+static const int rook_dirs[4][2]   = { {-1,0}, {1,0}, {0,-1}, {0,1} };
+static const int bishop_dirs[4][2] = { {-1,-1}, {-1,1}, {1,-1}, {1,1} };
+
+// The slow way, used to build the tables
+static uint64_t RayAttacks( int sq, uint64_t occ, const int dirs[4][2], bool relevant_only=false )
+{
+    uint64_t att = 0;
+    for( int d=0; d<4; d++ )
+    {
+        int r = sq/8 + dirs[d][0];
+        int f = sq%8 + dirs[d][1];
+        while( 0<=r && r<8 && 0<=f && f<8 )
+        {
+            int nr = r + dirs[d][0];
+            int nf = f + dirs[d][1];
+            bool last = !(0<=nr && nr<8 && 0<=nf && nf<8);
+            if( relevant_only && last )
+                break;
+            att |= BIT(r*8+f);
+            if( occ & BIT(r*8+f) )
+                break;
+            r = nr;
+            f = nf;
+        }
+    }
+    return att;
+}
+
+struct BitboardTables
+{
+    uint64_t knight[64];
+    uint64_t king[64];
+    uint64_t pawn[2][64];           // squares attacked by a [0=white,1=black] pawn on a square
+    uint64_t rook_empty[64];        // attacks on an empty board
+    uint64_t bishop_empty[64];
+    uint64_t between[64][64];       // squares strictly between two squares on a line, else 0
+    uint64_t line[64][64];          // the whole line through two squares, else 0
+    SliderEntry rook[64];
+    SliderEntry bishop[64];
+    std::vector<uint64_t> rook_attacks;
+    std::vector<uint64_t> bishop_attacks;
+    BitboardTables();
+    void InitSlider( SliderEntry *entries, std::vector<uint64_t> &store, const int dirs[4][2], const uint64_t *magics );
+};
+
+// Deterministic, so magics found are the same every run
+static uint64_t Rand64( uint64_t &state )
+{
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+// Magics found by the search below with its fixed seed, so normally no search is needed.
+//  Regenerated automatically (just slower) should the masks ever change
+static const uint64_t rook_magics[64] =
+{
+    0x1080004008801020ULL, 0x0840092002c03000ULL, 0x1900200010400900ULL, 0x0880100008000480ULL,
+    0x4200100420080200ULL, 0x8100020100080400ULL, 0x0200040110886200ULL, 0x0200008040220411ULL,
+    0x0404800084400220ULL, 0x0000401000402000ULL, 0x0086001081220440ULL, 0x0408800800100280ULL,
+    0x000a001201040820ULL, 0x8848800200840080ULL, 0x4001000100040200ULL, 0x0442000102105084ULL,
+    0x9080010020804100ULL, 0x0040404000201009ULL, 0x0000808010002009ULL, 0x2200090021d00100ULL,
+    0x0008008008040080ULL, 0x0004004002010040ULL, 0x0011040008015042ULL, 0x00000a0001768104ULL,
+    0x0000800080204009ULL, 0x2010004140002001ULL, 0x9800200280100080ULL, 0x1000100080080080ULL,
+    0x0442000a00049020ULL, 0x2100040080020080ULL, 0x0800120400900148ULL, 0x0010040a00128541ULL,
+    0x2800804000800030ULL, 0x1010002000400041ULL, 0x4000200011004100ULL, 0x0610008410800800ULL,
+    0x0400802402800800ULL, 0xc100020080800400ULL, 0x0002000802000401ULL, 0x0182085882000401ULL,
+    0x0220204000808000ULL, 0x2860100040024022ULL, 0x0001002004110040ULL, 0x99101042000a0020ULL,
+    0x0004080004008080ULL, 0x0010040002008080ULL, 0x2012004881020004ULL, 0x8300842444820011ULL,
+    0x0088403882010200ULL, 0x0820400080210100ULL, 0x0110910040a00300ULL, 0x0801100280080480ULL,
+    0x0242009008200600ULL, 0x1002000489500200ULL, 0x0040800200010080ULL, 0x0091800041000080ULL,
+    0x0000209300488001ULL, 0x04c1002414824001ULL, 0x020020000b001041ULL, 0x7000100004200901ULL,
+    0x8002002004100802ULL, 0x30010002084c0007ULL, 0x0888221800813004ULL, 0x4000002840840112ULL
+};
+static const uint64_t bishop_magics[64] =
+{
+    0x10102002004a1420ULL, 0x8020040400584008ULL, 0x10510800811201c8ULL, 0x5204042080000088ULL,
+    0x2204106880000002ULL, 0x1401042004000000ULL, 0x0400880410042004ULL, 0x0028208200a02020ULL,
+    0x1500241990010e00ULL, 0x8001200182020a40ULL, 0x40004101030b0000ULL, 0x8002041042000100ULL,
+    0x4010011041020038ULL, 0x0000010421044000ULL, 0x1500210808020a00ULL, 0x8000088400880520ULL,
+    0x0405004010040100ULL, 0x1005823210040108ULL, 0x2708008102040011ULL, 0x4048200404009100ULL,
+    0x0018104101400024ULL, 0x0003000601190101ULL, 0x8004803108491000ULL, 0x8014241200820800ULL,
+    0x0006e080100c3040ULL, 0x0501044a11041800ULL, 0x9020300008004045ULL, 0x0894080000220040ULL,
+    0x1001010083104000ULL, 0x5004030040900080ULL, 0x000400422c012400ULL, 0x0002128698404812ULL,
+    0x1010108404900440ULL, 0x0928021182084100ULL, 0x2006080409020024ULL, 0x1010202020180080ULL,
+    0xa010008200202200ULL, 0x2098015100019004ULL, 0x0002041440810811ULL, 0x802a02020000b098ULL,
+    0x0009015090004060ULL, 0x4000821082081001ULL, 0x0100210040420800ULL, 0x0800004010488a00ULL,
+    0x2000081104004040ULL, 0x4c8e029015000082ULL, 0x0420340322224842ULL, 0x1298260043400210ULL,
+    0x0000822802400008ULL, 0x00008a0101600000ULL, 0x3040003412080021ULL, 0x3040290220884800ULL,
+    0x4a1500401041004aULL, 0x8010200282020781ULL, 0x0020203142209091ULL, 0x0070300600902110ULL,
+    0x0040808800b62048ULL, 0x0000810400c44420ULL, 0x00080400440c0441ULL, 0x8340080020840411ULL,
+    0x0000000104208200ULL, 0x0000800810d00080ULL, 0x0400530411080200ULL, 0x4040702400932244ULL
+};
+
+void BitboardTables::InitSlider( SliderEntry *entries, std::vector<uint64_t> &store, const int dirs[4][2], const uint64_t *magics )
+{
+    size_t total = 0;
+    for( int sq=0; sq<64; sq++ )
+        total += (size_t)1 << PopCount( RayAttacks(sq,0,dirs,true) );
+    store.assign( total, 0 );
+    std::vector<uint64_t> occs, refs;
+    std::vector<int> epoch;
+    uint64_t state = 0x9e3779b97f4a7c15ULL;
+    size_t offset = 0;
+    for( int sq=0; sq<64; sq++ )
+    {
+        SliderEntry &e = entries[sq];
+        e.mask  = RayAttacks(sq,0,dirs,true);
+        int bits = PopCount(e.mask);
+        size_t size = (size_t)1 << bits;
+        e.shift = 64-bits;
+        e.magic = 0;
+        uint64_t *table = &store[offset];
+        e.attacks = table;
+        offset += size;
+
+        // Every subset of the mask (Carry-Rippler) and its attacks
+        occs.clear();
+        refs.clear();
+        uint64_t b = 0;
+        do
+        {
+            occs.push_back(b);
+            refs.push_back( RayAttacks(sq,b,dirs) );
+            b = (b - e.mask) & e.mask;
+        } while( b );
+        #ifdef BB_USE_PEXT
+        for( size_t i=0; i<occs.size(); i++ )
+            table[ _pext_u64(occs[i],e.mask) ] = refs[i];
+        #else
+        epoch.assign( size, 0 );
+        for( int attempt=1; ; attempt++ )
+        {
+            uint64_t magic = magics[sq];
+            if( attempt > 1 )
+            {
+                magic = Rand64(state) & Rand64(state) & Rand64(state);
+                if( PopCount( (e.mask*magic) >> 56 ) < 6 )
+                    continue;
+            }
+            bool ok = true;
+            for( size_t i=0; ok && i<occs.size(); i++ )
+            {
+                size_t idx = static_cast<size_t>( (occs[i]*magic) >> e.shift );
+                if( epoch[idx] < attempt )
+                {
+                    epoch[idx] = attempt;
+                    table[idx] = refs[i];
+                }
+                else if( table[idx] != refs[i] )
+                    ok = false;
+            }
+            if( ok )
+            {
+                e.magic = magic;
+                break;
+            }
+        }
+        #endif
+    }
+}
+
+BitboardTables::BitboardTables()
+{
+    static const int knight_steps[8][2] = { {-2,-1}, {-2,1}, {-1,-2}, {-1,2}, {1,-2}, {1,2}, {2,-1}, {2,1} };
+    static const int king_steps[8][2]   = { {-1,-1}, {-1,0}, {-1,1}, {0,-1}, {0,1}, {1,-1}, {1,0}, {1,1} };
+    memset( between, 0, sizeof(between) );
+    memset( line, 0, sizeof(line) );
+    for( int sq=0; sq<64; sq++ )
+    {
+        int r = sq/8;
+        int f = sq%8;
+        knight[sq] = king[sq] = 0;
+        for( int i=0; i<8; i++ )
+        {
+            int nr = r+knight_steps[i][0], nf = f+knight_steps[i][1];
+            if( 0<=nr && nr<8 && 0<=nf && nf<8 )
+                knight[sq] |= BIT(nr*8+nf);
+            nr = r+king_steps[i][0];
+            nf = f+king_steps[i][1];
+            if( 0<=nr && nr<8 && 0<=nf && nf<8 )
+                king[sq] |= BIT(nr*8+nf);
+        }
+        pawn[0][sq] = pawn[1][sq] = 0;
+        if( r > 0 )
+        {
+            if( f > 0 ) pawn[0][sq] |= BIT(sq-9);
+            if( f < 7 ) pawn[0][sq] |= BIT(sq-7);
+        }
+        if( r < 7 )
+        {
+            if( f > 0 ) pawn[1][sq] |= BIT(sq+7);
+            if( f < 7 ) pawn[1][sq] |= BIT(sq+9);
+        }
+        rook_empty[sq]   = RayAttacks(sq,0,rook_dirs);
+        bishop_empty[sq] = RayAttacks(sq,0,bishop_dirs);
+
+        // Lines, in all 8 directions
+        for( int d=0; d<8; d++ )
+        {
+            const int *dir = d<4 ? rook_dirs[d] : bishop_dirs[d-4];
+            uint64_t full = BIT(sq);
+            for( int sign=-1; sign<=1; sign+=2 )
+            {
+                int nr = r+sign*dir[0], nf = f+sign*dir[1];
+                while( 0<=nr && nr<8 && 0<=nf && nf<8 )
+                {
+                    full |= BIT(nr*8+nf);
+                    nr += sign*dir[0];
+                    nf += sign*dir[1];
+                }
+            }
+            uint64_t path = 0;
+            int nr = r+dir[0], nf = f+dir[1];
+            while( 0<=nr && nr<8 && 0<=nf && nf<8 )
+            {
+                int s = nr*8+nf;
+                between[sq][s] = path;
+                line[sq][s] = full;
+                path |= BIT(s);
+                nr += dir[0];
+                nf += dir[1];
+            }
+        }
+    }
+    InitSlider( rook,   rook_attacks,   rook_dirs,   rook_magics );
+    InitSlider( bishop, bishop_attacks, bishop_dirs, bishop_magics );
+}
+
+// Built on first use
+static const BitboardTables &Tables()
+{
+    static BitboardTables tables;
+    return tables;
+}
+
+static inline uint64_t SliderAttacks( const SliderEntry &e, uint64_t occ )
+{
+#ifdef BB_USE_PEXT
+    return e.attacks[ _pext_u64(occ,e.mask) ];
+#else
+    return e.attacks[ ((occ&e.mask)*e.magic) >> e.shift ];
+#endif
+}
+
+static const char piece_chars[2][7] = { "PNBRQK", "pnbrqk" };
+
+void BitboardPosition::Set( const thc::ChessPosition &cp )
+{
+    memset( pieces, 0, sizeof(pieces) );
+    occupied[0] = occupied[1] = 0;
+    memcpy( squares, cp.squares, 64 );
+    for( int sq=0; sq<64; sq++ )
+    {
+        const char *p;
+        char c = squares[sq];
+        int colour = -1;
+        if( c && (p=strchr(piece_chars[0],c)) != NULL )
+        {
+            colour = 0;
+            pieces[0][p-piece_chars[0]] |= BIT(sq);
+        }
+        else if( c && (p=strchr(piece_chars[1],c)) != NULL )
+        {
+            colour = 1;
+            pieces[1][p-piece_chars[1]] |= BIT(sq);
+        }
+        else
+            squares[sq] = ' ';
+        if( colour >= 0 )
+            occupied[colour] |= BIT(sq);
+    }
+    all = occupied[0] | occupied[1];
+    white  = cp.white;
+    enpassant_target = cp.enpassant_target;
+    wking  = cp.wking  ? true : false;
+    wqueen = cp.wqueen ? true : false;
+    bking  = cp.bking  ? true : false;
+    bqueen = cp.bqueen ? true : false;
+    const uint64_t back_ranks = 0xff000000000000ffULL;
+    supported = PopCount(pieces[0][BB_KING])==1 && PopCount(pieces[1][BB_KING])==1 &&
+                0 == ((pieces[0][BB_PAWN]|pieces[1][BB_PAWN]) & back_ranks) &&
+                Lsb(pieces[0][BB_KING]) == cp.wking_square &&
+                Lsb(pieces[1][BB_KING]) == cp.bking_square &&
+                pieces[0][BB_KING] != BIT(thc::e8) &&
+                pieces[1][BB_KING] != BIT(thc::e1) &&
+                (enpassant_target==thc::SQUARE_INVALID || (0<=enpassant_target && enpassant_target<64));
+    if( supported && enpassant_target!=thc::SQUARE_INVALID )
+    {
+        // thc doesn't check there's a pawn to capture, require a sensible target
+        int victim = white ? enpassant_target+8 : enpassant_target-8;
+        supported = (victim>=0 && victim<64 && squares[enpassant_target]==' ' && squares[victim]==(white?'p':'P'));
+    }
+    UpdateCheckInfo();
+}
+
+void BitboardPosition::Get( thc::ChessPosition &cp ) const
+{
+    memcpy( cp.squares, squares, 64 );
+    cp.squares[64] = '\0';
+    cp.white = white;
+    cp.enpassant_target = static_cast<thc::Square>(enpassant_target);
+    cp.wking  = wking;
+    cp.wqueen = wqueen;
+    cp.bking  = bking;
+    cp.bqueen = bqueen;
+    if( pieces[0][BB_KING] )
+        cp.wking_square = static_cast<thc::Square>( Lsb(pieces[0][BB_KING]) );
+    if( pieces[1][BB_KING] )
+        cp.bking_square = static_cast<thc::Square>( Lsb(pieces[1][BB_KING]) );
+}
+
+// Is sq attacked by side 'by' (0=white,1=black), given occupancy occ ?
+bool BitboardPosition::Attacked( int sq, uint64_t occ, int by ) const
+{
+    const BitboardTables &t = Tables();
+    const uint64_t *p = pieces[by];
+    if( t.knight[sq] & p[BB_KNIGHT] )
+        return true;
+    if( t.king[sq] & p[BB_KING] )
+        return true;
+    if( t.pawn[1-by][sq] & p[BB_PAWN] )
+        return true;
+    if( SliderAttacks(t.rook[sq],occ) & (p[BB_ROOK]|p[BB_QUEEN]) )
+        return true;
+    if( SliderAttacks(t.bishop[sq],occ) & (p[BB_BISHOP]|p[BB_QUEEN]) )
+        return true;
+    return false;
+}
+
+// Find the enemy pieces checking the side to move's king, and the friendly pieces
+//  pinned to it (the only piece between the king and an enemy slider)
+void BitboardPosition::UpdateCheckInfo()
+{
+    checkers = pinned = 0;
+    int us   = white ? 0 : 1;
+    int them = 1-us;
+    if( !pieces[us][BB_KING] )
+        return;
+    const BitboardTables &t = Tables();
+    const uint64_t *their = pieces[them];
+    int ksq = Lsb( pieces[us][BB_KING] );
+    checkers = (t.knight[ksq] & their[BB_KNIGHT]) | (t.pawn[us][ksq] & their[BB_PAWN]) |
+               (SliderAttacks(t.rook[ksq],all)   & (their[BB_ROOK]|their[BB_QUEEN])) |
+               (SliderAttacks(t.bishop[ksq],all) & (their[BB_BISHOP]|their[BB_QUEEN]));
+    uint64_t snipers = (t.rook_empty[ksq]   & (their[BB_ROOK]|their[BB_QUEEN])) |
+                       (t.bishop_empty[ksq] & (their[BB_BISHOP]|their[BB_QUEEN]));
+    while( snipers )
+    {
+        int s = PopLsb(snipers);
+        uint64_t b = t.between[ksq][s] & all;
+        if( b && !(b&(b-1)) && (b&occupied[us]) )
+            pinned |= b;
+    }
+}
+
+static inline thc::Move *AddMove( thc::Move *m, int src, int dst, thc::SPECIAL special, char capture )
+{
+    m->src     = static_cast<thc::Square>(src);
+    m->dst     = static_cast<thc::Square>(dst);
+    m->special = special;
+    m->capture = capture;
+    return m+1;
+}
+
+static inline thc::Move *AddPromotions( thc::Move *m, int src, int dst, char capture )
+{
+    m = AddMove( m, src, dst, thc::SPECIAL_PROMOTION_QUEEN,  capture );
+    m = AddMove( m, src, dst, thc::SPECIAL_PROMOTION_KNIGHT, capture );
+    m = AddMove( m, src, dst, thc::SPECIAL_PROMOTION_BISHOP, capture );
+    m = AddMove( m, src, dst, thc::SPECIAL_PROMOTION_ROOK,   capture );
+    return m;
+}
+
+int BitboardPosition::GenLegalMoveList( thc::Move *moves ) const
+{
+    const BitboardTables &t = Tables();
+    thc::Move *m = moves;
+    int us   = white ? 0 : 1;
+    int them = 1-us;
+    const uint64_t *mine  = pieces[us];
+    uint64_t own   = occupied[us];
+    uint64_t enemy = occupied[them];
+    int ksq = Lsb( mine[BB_KING] );
+
+    // King moves, the king itself mustn't block attacks on the squares it moves to
+    uint64_t occ_no_king = all ^ BIT(ksq);
+    uint64_t k = t.king[ksq] & ~own;
+    while( k )
+    {
+        int dst = PopLsb(k);
+        if( !Attacked(dst,occ_no_king,them) )
+            m = AddMove( m, ksq, dst, thc::SPECIAL_KING_MOVE, squares[dst] );
+    }
+    int nbr_checkers = PopCount(checkers);
+    if( nbr_checkers > 1 )
+        return static_cast<int>(m-moves);
+
+    // Castling, exactly as thc's conditions
+    if( nbr_checkers == 0 )
+    {
+        if( ksq == thc::e1 )
+        {
+            if( wking && squares[thc::f1]==' ' && squares[thc::g1]==' ' && squares[thc::h1]=='R' &&
+                !Attacked(thc::f1,all,them) && !Attacked(thc::g1,all,them) )
+                m = AddMove( m, thc::e1, thc::g1, thc::SPECIAL_WK_CASTLING, ' ' );
+            if( wqueen && squares[thc::b1]==' ' && squares[thc::c1]==' ' && squares[thc::d1]==' ' && squares[thc::a1]=='R' &&
+                !Attacked(thc::d1,all,them) && !Attacked(thc::c1,all,them) )
+                m = AddMove( m, thc::e1, thc::c1, thc::SPECIAL_WQ_CASTLING, ' ' );
+        }
+        else if( ksq == thc::e8 )
+        {
+            if( bking && squares[thc::f8]==' ' && squares[thc::g8]==' ' && squares[thc::h8]=='r' &&
+                !Attacked(thc::f8,all,them) && !Attacked(thc::g8,all,them) )
+                m = AddMove( m, thc::e8, thc::g8, thc::SPECIAL_BK_CASTLING, ' ' );
+            if( bqueen && squares[thc::b8]==' ' && squares[thc::c8]==' ' && squares[thc::d8]==' ' && squares[thc::a8]=='r' &&
+                !Attacked(thc::d8,all,them) && !Attacked(thc::c8,all,them) )
+                m = AddMove( m, thc::e8, thc::c8, thc::SPECIAL_BQ_CASTLING, ' ' );
+        }
+    }
+
+    // Other pieces must capture or block a single checker
+    uint64_t target = ~own;
+    if( nbr_checkers == 1 )
+        target &= (checkers | t.between[ksq][Lsb(checkers)]);
+
+    // Knights (a pinned knight can never move)
+    uint64_t b = mine[BB_KNIGHT] & ~pinned;
+    while( b )
+    {
+        int src = PopLsb(b);
+        uint64_t a = t.knight[src] & target;
+        while( a )
+        {
+            int dst = PopLsb(a);
+            m = AddMove( m, src, dst, thc::NOT_SPECIAL, squares[dst] );
+        }
+    }
+
+    // Sliders
+    for( int piece=BB_BISHOP; piece<=BB_QUEEN; piece++ )
+    {
+        b = mine[piece];
+        while( b )
+        {
+            int src = PopLsb(b);
+            uint64_t a = 0;
+            if( piece != BB_ROOK )
+                a |= SliderAttacks(t.bishop[src],all);
+            if( piece != BB_BISHOP )
+                a |= SliderAttacks(t.rook[src],all);
+            a &= target;
+            if( pinned & BIT(src) )
+                a &= t.line[ksq][src];
+            while( a )
+            {
+                int dst = PopLsb(a);
+                m = AddMove( m, src, dst, thc::NOT_SPECIAL, squares[dst] );
+            }
+        }
+    }
+
+    // Pawns
+    int forward      = white ? -8 : 8;
+    int start_row    = white ? 6 : 1;
+    int promote_row  = white ? 1 : 6;
+    thc::SPECIAL two_squares = white ? thc::SPECIAL_WPAWN_2SQUARES : thc::SPECIAL_BPAWN_2SQUARES;
+    b = mine[BB_PAWN];
+    while( b )
+    {
+        int src = PopLsb(b);
+        uint64_t allowed = (pinned & BIT(src)) ? t.line[ksq][src] : ~0ULL;
+        bool promotion = (src/8 == promote_row);
+        int dst = src+forward;
+        if( !(all & BIT(dst)) )
+        {
+            if( BIT(dst) & target & allowed )
+            {
+                if( promotion )
+                    m = AddPromotions( m, src, dst, ' ' );
+                else
+                    m = AddMove( m, src, dst, thc::NOT_SPECIAL, ' ' );
+            }
+            int dst2 = dst+forward;
+            if( src/8==start_row && !(all & BIT(dst2)) && (BIT(dst2) & target & allowed) )
+                m = AddMove( m, src, dst2, two_squares, ' ' );
+        }
+        uint64_t a = t.pawn[us][src] & enemy & target & allowed;
+        while( a )
+        {
+            dst = PopLsb(a);
+            if( promotion )
+                m = AddPromotions( m, src, dst, squares[dst] );
+            else
+                m = AddMove( m, src, dst, thc::NOT_SPECIAL, squares[dst] );
+        }
+
+        // En passant, rare enough to just try it and see
+        if( enpassant_target!=thc::SQUARE_INVALID && (t.pawn[us][src] & BIT(enpassant_target)) )
+        {
+            thc::Move ep;
+            ep.src = static_cast<thc::Square>(src);
+            ep.dst = static_cast<thc::Square>(enpassant_target);
+            ep.special = white ? thc::SPECIAL_WEN_PASSANT : thc::SPECIAL_BEN_PASSANT;
+            ep.capture = white ? 'p' : 'P';
+            BitboardPosition after = *this;
+            after.PlayMove(ep);
+            if( !after.Attacked( ksq, after.all, them ) )
+                *m++ = ep;
+        }
+    }
+    return static_cast<int>(m-moves);
+}
+
+void BitboardPosition::PlayMove( thc::Move mv )
+{
+    int us = white ? 0 : 1;
+    int src = mv.src;
+    int dst = mv.dst;
+    const char *chars = piece_chars[us];
+    const char *p;
+
+    // Castling flags are cleared by arrival on a king or rook home square, as thc
+    switch( dst )
+    {
+        case thc::a1: wqueen = false;                   break;
+        case thc::e1: wqueen = false;   wking = false;  break;
+        case thc::h1: wking  = false;                   break;
+        case thc::a8: bqueen = false;                   break;
+        case thc::e8: bqueen = false;   bking = false;  break;
+        case thc::h8: bking  = false;                   break;
+    }
+    enpassant_target = thc::SQUARE_INVALID;
+
+    // Remove anything captured
+    int victim = dst;
+    if( mv.special==thc::SPECIAL_WEN_PASSANT )
+        victim = dst+8;
+    else if( mv.special==thc::SPECIAL_BEN_PASSANT )
+        victim = dst-8;
+    char c = squares[victim];
+    if( c != ' ' )
+    {
+        int them = 1-us;
+        if( (p=strchr(piece_chars[them],c)) != NULL )
+            pieces[them][p-piece_chars[them]] &= ~BIT(victim);
+        else if( (p=strchr(chars,c)) != NULL )
+            pieces[us][p-chars] &= ~BIT(victim);
+        occupied[0] &= ~BIT(victim);
+        occupied[1] &= ~BIT(victim);
+        squares[victim] = ' ';
+    }
+
+    // Move the piece (promotions change it on the way)
+    char moving = squares[src];
+    int idx = BB_PAWN;
+    if( (p=strchr(chars,moving)) != NULL )
+        idx = static_cast<int>(p-chars);
+    int new_idx = idx;
+    switch( mv.special )
+    {
+        case thc::SPECIAL_PROMOTION_QUEEN:  new_idx = BB_QUEEN;     break;
+        case thc::SPECIAL_PROMOTION_ROOK:   new_idx = BB_ROOK;      break;
+        case thc::SPECIAL_PROMOTION_BISHOP: new_idx = BB_BISHOP;    break;
+        case thc::SPECIAL_PROMOTION_KNIGHT: new_idx = BB_KNIGHT;    break;
+        case thc::SPECIAL_WPAWN_2SQUARES:   enpassant_target = dst+8;   break;
+        case thc::SPECIAL_BPAWN_2SQUARES:   enpassant_target = dst-8;   break;
+        default:                                                    break;
+    }
+    pieces[us][idx]     &= ~BIT(src);
+    pieces[us][new_idx] |= BIT(dst);
+    occupied[us] = (occupied[us] & ~BIT(src)) | BIT(dst);
+    squares[src] = ' ';
+    squares[dst] = chars[new_idx];
+
+    // And the rook if castling
+    int rook_src=-1, rook_dst=-1;
+    switch( mv.special )
+    {
+        case thc::SPECIAL_WK_CASTLING: rook_src = thc::h1; rook_dst = thc::f1; break;
+        case thc::SPECIAL_WQ_CASTLING: rook_src = thc::a1; rook_dst = thc::d1; break;
+        case thc::SPECIAL_BK_CASTLING: rook_src = thc::h8; rook_dst = thc::f8; break;
+        case thc::SPECIAL_BQ_CASTLING: rook_src = thc::a8; rook_dst = thc::d8; break;
+        default:                                                               break;
+    }
+    if( rook_src >= 0 )
+    {
+        pieces[us][BB_ROOK] = (pieces[us][BB_ROOK] & ~BIT(rook_src)) | BIT(rook_dst);
+        occupied[us] = (occupied[us] & ~BIT(rook_src)) | BIT(rook_dst);
+        squares[rook_src] = ' ';
+        squares[rook_dst] = chars[BB_ROOK];
+    }
+    all = occupied[0] | occupied[1];
+    white = !white;
+    UpdateCheckInfo();
+}
+
+bool BitboardPosition::Evaluate( thc::TERMINAL &terminal ) const
+{
+    terminal = thc::NOT_TERMINAL;
+    int them = white ? 1 : 0;
+    if( pieces[them][BB_KING] && Attacked( Lsb(pieces[them][BB_KING]), all, 1-them ) )
+        return false;
+    thc::Move moves[MAXMOVES];
+    if( GenLegalMoveList(moves) == 0 )
+    {
+        if( InCheck() )
+            terminal = white ? thc::TERMINAL_WCHECKMATE : thc::TERMINAL_BCHECKMATE;
+        else
+            terminal = white ? thc::TERMINAL_WSTALEMATE : thc::TERMINAL_BSTALEMATE;
+    }
+    return true;
+}
+
+bool BitboardEvaluate( thc::ChessRules *cr, thc::TERMINAL &terminal )
+{
+    BitboardPosition bb(*cr);
+    if( !bb.Supported() )
+        return cr->Evaluate( terminal );
+    return bb.Evaluate( terminal );
+}
+
+static inline bool IsPromotion( thc::SPECIAL special )
+{
+    return special==thc::SPECIAL_PROMOTION_QUEEN  || special==thc::SPECIAL_PROMOTION_ROOK ||
+           special==thc::SPECIAL_PROMOTION_BISHOP || special==thc::SPECIAL_PROMOTION_KNIGHT;
+}
+
+bool BitboardTerseIn( thc::Move &mv, thc::ChessRules *cr, const char *tmove )
+{
+    BitboardPosition bb(*cr);
+    if( !bb.Supported() )
+        return mv.TerseIn( cr, tmove );
+    if( strlen(tmove)<4 || tmove[0]<'a' || tmove[0]>'h' || tmove[1]<'1' || tmove[1]>'8'
+                        || tmove[2]<'a' || tmove[2]>'h' || tmove[3]<'1' || tmove[3]>'8' )
+        return false;
+    int src = (tmove[0]-'a') + ('8'-tmove[1])*8;
+    int dst = (tmove[2]-'a') + ('8'-tmove[3])*8;
+    thc::SPECIAL promotion = thc::SPECIAL_PROMOTION_QUEEN;     // thc's default, even for "e7e8x"
+    switch( tmove[4] )
+    {
+        case 'n': case 'N': promotion = thc::SPECIAL_PROMOTION_KNIGHT;  break;
+        case 'b': case 'B': promotion = thc::SPECIAL_PROMOTION_BISHOP;  break;
+        case 'r': case 'R': promotion = thc::SPECIAL_PROMOTION_ROOK;    break;
+        default:                                                        break;
+    }
+    thc::Move moves[MAXMOVES];
+    int n = bb.GenLegalMoveList( moves );
+    for( int i=0; i<n; i++ )
+    {
+        const thc::Move &m = moves[i];
+        if( m.src!=src || m.dst!=dst )
+            continue;
+        if( !IsPromotion(m.special) || m.special==promotion )
+        {
+            mv = m;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline bool IsCastling( thc::SPECIAL special )
+{
+    return special==thc::SPECIAL_WK_CASTLING || special==thc::SPECIAL_WQ_CASTLING ||
+           special==thc::SPECIAL_BK_CASTLING || special==thc::SPECIAL_BQ_CASTLING;
+}
+
+static thc::SPECIAL PromotionSpecial( char c )
+{
+    switch( c )
+    {
+        case 'Q':   return thc::SPECIAL_PROMOTION_QUEEN;
+        case 'R':   return thc::SPECIAL_PROMOTION_ROOK;
+        case 'B':   return thc::SPECIAL_PROMOTION_BISHOP;
+        case 'N':   return thc::SPECIAL_PROMOTION_KNIGHT;
+        default:    return thc::NOT_SPECIAL;
+    }
+}
+
+bool BitboardNaturalIn( thc::Move &mv, thc::ChessRules *cr, const char *natural_in )
+{
+    BitboardPosition bb(*cr);
+    if( !bb.Supported() )
+        return mv.NaturalIn( cr, natural_in );
+
+    // Parse plain SAN; piece, source file and/or rank hints, capture, destination, promotion
+    const char *s = natural_in;
+    bool castling=false, long_castling=false, capture=false;
+    char piece='P', hint_file='\0', hint_rank='\0';
+    int dst = -1;
+    thc::SPECIAL promotion = thc::NOT_SPECIAL;
+    bool plain = true;
+    if( 0 == memcmp(s,"O-O-O",5) )
+    {
+        castling = long_castling = true;
+        s += 5;
+    }
+    else if( 0 == memcmp(s,"O-O",3) )
+    {
+        castling = true;
+        s += 3;
+    }
+    else
+    {
+        if( *s && strchr("KQRBN",*s) )
+            piece = *s++;
+        char buf[5];
+        int len = 0;
+        while( len<5 && (('a'<=*s && *s<='h') || ('1'<=*s && *s<='8') || *s=='x') )
+            buf[len++] = *s++;
+        if( len<2 || buf[len-2]<'a' || buf[len-2]>'h' || buf[len-1]<'1' || buf[len-1]>'8' )
+            plain = false;
+        else
+        {
+            dst = (buf[len-2]-'a') + ('8'-buf[len-1])*8;
+            for( int i=0; plain && i<len-2; i++ )
+            {
+                char c = buf[i];
+                if( c=='x' && !capture && i==len-3 )
+                    capture = true;
+                else if( 'a'<=c && c<='h' && !hint_file && !hint_rank )
+                    hint_file = c;
+                else if( '1'<=c && c<='8' && !hint_rank )
+                    hint_rank = c;
+                else
+                    plain = false;
+            }
+            if( piece=='P' && *s=='=' )
+                s++;
+            if( piece=='P' && *s && strchr("QRBN",*s) )
+                promotion = PromotionSpecial(*s++);
+        }
+    }
+    while( *s=='+' || *s=='#' || *s=='!' || *s=='?' )
+        s++;
+    if( *s!='\0' && *s!=' ' && *s!='\t' && *s!='\r' && *s!='\n' )
+        plain = false;
+
+    // The move is only certain if exactly one legal move fits
+    int nbr_matches = 0;
+    thc::Move match;
+    if( plain )
+    {
+        thc::Move moves[MAXMOVES];
+        int n = bb.GenLegalMoveList( moves );
+        for( int i=0; i<n; i++ )
+        {
+            const thc::Move &m = moves[i];
+            if( castling )
+            {
+                bool long_one = (m.special==thc::SPECIAL_WQ_CASTLING || m.special==thc::SPECIAL_BQ_CASTLING);
+                if( IsCastling(m.special) && long_one==long_castling )
+                {
+                    match = m;
+                    nbr_matches++;
+                }
+                continue;
+            }
+            if( m.dst!=dst || IsCastling(m.special) || toupper(cr->squares[m.src])!=piece )
+                continue;
+            if( (hint_file && 'a'+(m.src&7)!=hint_file) || (hint_rank && '8'-(m.src>>3)!=hint_rank) )
+                continue;
+            if( IsPromotion(m.special) ? m.special!=promotion : promotion!=thc::NOT_SPECIAL )
+                continue;
+            match = m;
+            nbr_matches++;
+        }
+    }
+    if( nbr_matches==1 && (castling || capture==(match.capture!=' ')) )
+    {
+        mv = match;
+        return true;
+    }
+    return mv.NaturalIn( cr, natural_in );
+}
+
+std::string BitboardNaturalOut( thc::Move mv, thc::ChessRules *cr )
+{
+    BitboardPosition bb(*cr);
+    if( !bb.Supported() )
+        return mv.NaturalOut( cr );
+    thc::Move moves[MAXMOVES];
+    int n = bb.GenLegalMoveList( moves );
+    bool found = false;
+    for( int i=0; !found && i<n; i++ )
+        found = (moves[i] == mv);
+    if( !found )
+        return "--";
+
+    // Same notation choices as thc, including the order it tries disambiguation in
+    char nmove[10];
+    int src = mv.src;
+    int dst = mv.dst;
+    char src_file = 'a'+(src&7), src_rank = '8'-(src>>3);
+    char dst_file = 'a'+(dst&7), dst_rank = '8'-(dst>>3);
+    const char *x = (mv.capture!=' ' ? "x" : "");
+    char p = static_cast<char>( toupper(cr->squares[src]) );
+    if( p == 'P' )
+    {
+        if( *x )
+            sprintf( nmove, "%cx%c%c", src_file, dst_file, dst_rank );
+        else
+            sprintf( nmove, "%c%c", dst_file, dst_rank );
+        switch( mv.special )
+        {
+            case thc::SPECIAL_PROMOTION_QUEEN:  strcat( nmove, "=Q" );  break;
+            case thc::SPECIAL_PROMOTION_ROOK:   strcat( nmove, "=R" );  break;
+            case thc::SPECIAL_PROMOTION_BISHOP: strcat( nmove, "=B" );  break;
+            case thc::SPECIAL_PROMOTION_KNIGHT: strcat( nmove, "=N" );  break;
+            default:                                                    break;
+        }
+    }
+    else if( mv.special==thc::SPECIAL_WK_CASTLING || mv.special==thc::SPECIAL_BK_CASTLING )
+        strcpy( nmove, "O-O" );
+    else if( mv.special==thc::SPECIAL_WQ_CASTLING || mv.special==thc::SPECIAL_BQ_CASTLING )
+        strcpy( nmove, "O-O-O" );
+    else
+    {
+        int same_dst=0, same_file=0, same_rank=0;
+        for( int i=0; i<n; i++ )
+        {
+            const thc::Move &m = moves[i];
+            if( m.dst==dst && toupper(cr->squares[m.src])==p && !IsCastling(m.special) )
+            {
+                same_dst++;
+                if( (m.src&7) == (src&7) )
+                    same_file++;
+                if( (m.src>>3) == (src>>3) )
+                    same_rank++;
+            }
+        }
+        if( same_dst == 1 )
+            sprintf( nmove, "%c%s%c%c", p, x, dst_file, dst_rank );
+        else if( same_file == 1 )
+            sprintf( nmove, "%c%c%s%c%c", p, src_file, x, dst_file, dst_rank );
+        else if( same_rank == 1 )
+            sprintf( nmove, "%c%c%s%c%c", p, src_rank, x, dst_file, dst_rank );
+        else
+            sprintf( nmove, "%c%c%c%s%c%c", p, src_file, src_rank, x, dst_file, dst_rank );
+    }
+
+    // Check is a lookup after the move, mate needs a move count
+    BitboardPosition after = bb;
+    after.PlayMove( mv );
+    if( after.InCheck() )
+        strcat( nmove, after.GenLegalMoveList(moves)==0 ? "#" : "+" );
+    return nmove;
+}
+
+uint64_t BitboardPerft( const BitboardPosition &pos, int depth )
+{
+    thc::Move moves[MAXMOVES];
+    int n = pos.GenLegalMoveList(moves);
+    if( depth <= 1 )
+        return depth==1 ? n : 1;
+    uint64_t total = 0;
+    for( int i=0; i<n; i++ )
+    {
+        BitboardPosition next = pos;
+        next.PlayMove( moves[i] );
+        total += BitboardPerft( next, depth-1 );
+    }
+    return total;
+}
+
+uint64_t ThcPerft( thc::ChessRules &cr, int depth )
+{
+    thc::MOVELIST list;
+    cr.GenLegalMoveList( &list );
+    if( depth <= 1 )
+        return depth==1 ? list.count : 1;
+    uint64_t total = 0;
+    for( int i=0; i<list.count; i++ )
+    {
+        cr.PushMove( list.moves[i] );
+        total += ThcPerft( cr, depth-1 );
+        cr.PopMove( list.moves[i] );
+    }
+    return total;
+}
+
+bool BitboardPerftBenchmark( int max_depth )
+{
+    static const struct
+    {
+        const char *name;
+        const char *fen;
+        int         depth;          // deepest published count we use
+        uint64_t    nodes[6];       // published counts for depth 1 to 6
+    } positions[] =
+    {
+        { "Initial",   "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",               5, { 20, 400, 8902, 197281, 4865609, 119060324 } },
+        { "Kiwipete",  "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",   4, { 48, 2039, 97862, 4085603, 193690690, 0 } },
+        { "Endgame",   "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",                              5, { 14, 191, 2812, 43238, 674624, 11030083 } },
+        { "Promotion", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",       4, { 6, 264, 9467, 422333, 15833292, 0 } },
+        { "Talkchess", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",              4, { 44, 1486, 62379, 2103487, 89941194, 0 } }
+    };
+    bool ok = true;
+    Tables();   // so table construction isn't timed
+    for( size_t i=0; i<sizeof(positions)/sizeof(positions[0]); i++ )
+    {
+        thc::ChessRules cr;
+        cr.Forsyth( positions[i].fen );
+        BitboardPosition pos(cr);
+        int depth = positions[i].depth<max_depth ? positions[i].depth : max_depth;
+        uint64_t expected = positions[i].nodes[depth-1];
+
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t nodes_thc = ThcPerft( cr, depth );
+        auto t1 = std::chrono::steady_clock::now();
+        uint64_t nodes_bb = BitboardPerft( pos, depth );
+        auto t2 = std::chrono::steady_clock::now();
+        double secs_thc = std::chrono::duration<double>(t1-t0).count();
+        double secs_bb  = std::chrono::duration<double>(t2-t1).count();
+        bool match = (nodes_thc==expected && nodes_bb==expected);
+        if( !match )
+            ok = false;
+        cprintf( "Perft %-9s depth %d: %s expected %llu, thc %llu (%.0f nodes/s), bitboard %llu (%.0f nodes/s), %.1fx\n",
+                 positions[i].name, depth, match?"OK  ":"FAIL",
+                 (unsigned long long)expected,
+                 (unsigned long long)nodes_thc, secs_thc>0.0 ? nodes_thc/secs_thc : 0.0,
+                 (unsigned long long)nodes_bb,  secs_bb>0.0  ? nodes_bb/secs_bb   : 0.0,
+                 secs_bb>0.0 ? secs_thc/secs_bb : 0.0 );
+    }
+    return ok;
+}
@@ -0,0 +1,92 @@
+/****************************************************************************
+ * Bitboard chess position and legal move generator, an optional faster
+ *  alternative to thc::ChessRules for hot paths that generate whole move lists
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef BITBOARD_POSITION_H
+#define BITBOARD_POSITION_H
+#include <stdint.h>
+#include <string>
+#include "thc.h"
+
+// Bit n of a bitboard is thc::Square n, so a8 is bit 0 and h1 is bit 63. Sliding
+//  piece attacks come from magic multiplication tables, or the PEXT instruction if
+//  the compiler is targeting BMI2
+#define BB_PAWN     0
+#define BB_KNIGHT   1
+#define BB_BISHOP   2
+#define BB_ROOK     3
+#define BB_QUEEN    4
+#define BB_KING     5
+
+class BitboardPosition
+{
+public:
+    BitboardPosition() {}
+    BitboardPosition( const thc::ChessPosition &cp ) { Set(cp); }
+
+    // Convert from and to the thc representation
+    void Set( const thc::ChessPosition &cp );
+    void Get( thc::ChessPosition &cp ) const;
+
+    // False for positions thc tolerates but our generator doesn't model quirk for quirk (no
+    //  king, two kings, pawns on the first or last rank, a king on the other side's
+    //  castling square, stale king square details). Use thc for those
+    bool Supported() const { return supported; }
+
+    // The same legal moves (same src, dst, special and capture) as thc::ChessRules
+    //  GenLegalMoveList(), although not in the same order. moves needs room for MAXMOVES
+    int  GenLegalMoveList( thc::Move *moves ) const;
+    void GenLegalMoveList( thc::MOVELIST *list ) const { list->count = GenLegalMoveList(list->moves); }
+
+    // As thc::ChessRules Evaluate(), returns false if the side that just moved is in check
+    //  (an illegal position), otherwise sets terminal to checkmate, stalemate or NOT_TERMINAL
+    bool Evaluate( thc::TERMINAL &terminal ) const;
+
+    // Same effect as thc::ChessRules::PushMove() on the board, castling flags, en
+    //  passant target and side to move
+    void PlayMove( thc::Move mv );
+
+    // Checks and pins on the side to move's king. Set() and PlayMove() keep these up to
+    //  date along with the piece bitboards, so they are simple lookups
+    bool     InCheck()  const { return checkers != 0; }
+    uint64_t Checkers() const { return checkers; }  // enemy pieces giving check
+    uint64_t Pinned()   const { return pinned; }    // friendly pieces pinned to the king
+
+private:
+    uint64_t pieces[2][6];      // [0=white,1=black][BB_PAWN..BB_KING]
+    uint64_t occupied[2];
+    uint64_t all;
+    uint64_t checkers;
+    uint64_t pinned;
+    char     squares[64];       // as thc::ChessPosition::squares, for capture and SAN details
+    bool     white;
+    int      enpassant_target;  // thc::SQUARE_INVALID if none
+    bool     wking, wqueen, bking, bqueen;
+    bool     supported;
+    bool Attacked( int sq, uint64_t occ, int by ) const;
+    void UpdateCheckInfo();
+};
+
+// Faster versions of thc::ChessRules Evaluate() and thc::Move TerseIn(), NaturalIn() and
+//  NaturalOut() with the same results, thc does the work for positions the bitboard
+//  generator doesn't support. BitboardNaturalIn() only takes the fast route for plain SAN
+//  like "Nbd2", "exd8=Q+" or "O-O", anything more exotic (long algebraic, "0-0", ambiguous
+//  or unexpected captures) goes to NaturalIn()
+bool        BitboardEvaluate( thc::ChessRules *cr, thc::TERMINAL &terminal );
+bool        BitboardTerseIn( thc::Move &mv, thc::ChessRules *cr, const char *tmove );
+bool        BitboardNaturalIn( thc::Move &mv, thc::ChessRules *cr, const char *natural_in );
+std::string BitboardNaturalOut( thc::Move mv, thc::ChessRules *cr );
+
+// Perft (number of leaf nodes of the legal move tree, to depth plies)
+uint64_t BitboardPerft( const BitboardPosition &pos, int depth );
+uint64_t ThcPerft( thc::ChessRules &cr, int depth );
+
+// Perft a set of standard test positions with both generators to max_depth (with
+//  deeper positions limited to keep things reasonable), check against the published
+//  node counts and print nodes/s for each. Returns false if anything doesn't match
+bool BitboardPerftBenchmark( int max_depth=4 );
+
+#endif // BITBOARD_POSITION_H
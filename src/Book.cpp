@@ -13,6 +13,7 @@
 #include "Repository.h"
 #include "Objects.h"
 #include "fseek64.h"
+#include "PgnTokenizer.h"
 #define nbrof(array) ( sizeof(array) / sizeof((array)[0]) )
 
 //#define REGENERATE
@@ -190,30 +191,27 @@ bool Book::Process( FILE *infile, wxProgressDialog &progress )
 {
     bool aborted = false;
     char buf[BOOK_BUFLEN+10];
-    static char comment_buf[10000];
-    int ch, comment_ch=0, previous_ch=0, push_back=0, len=0, move_number=0;
-    STATE state=INIT, old_state, save_state=INIT;
-    static int nag_value;
-    fseek64(infile,0,SEEK_END);
-    int64_t file_len = ftell64(infile);
-    rewind(infile);
+    int len, move_number=0;
+    STATE state=PREFIX;
+    PgnMappedFile mf;
+    mf.Open( infile );
+    PgnTokenizer tz( mf.Data(), mf.Length(), true, true );
+    PgnToken tok;
+    size_t file_len = tz.Length();
 
-    // Loop through characters
-    ch = fgetc(infile);
+    // Loop through tokens
     int old_percent = -1;
     unsigned char modulo_256=0;
-    while( ch != EOF )
+    GameBegin();
+    while( tz.Next(tok) )
     {
         if( modulo_256 == 0 )
         {
-            int64_t file_offset = ftell64(infile);
             int percent;
             if( file_len == 0 )
                 percent = 100;
-            else if( file_len < 10000000 )
-                percent = (int)( (file_offset*100L) / file_len );
-            else // if( file_len > 10000000 )
-                percent = (int)( file_offset / (file_len/100L) );
+            else
+                percent = (int)( (tok.offset*100.0) / file_len );
             if( percent != old_percent )
             {
 #if wxABI_VERSION > 28600
@@ -230,380 +228,99 @@ bool Book::Process( FILE *infile, wxProgressDialog &progress )
         }
         modulo_256++;
         modulo_256 &= 0xff;
-        if( push_back == '\0' )
+        for( size_t i=tok.offset; i<tok.end; i++ )
         {
-            error_buf[error_ptr++] = (char)ch;
+            error_buf[error_ptr++] = mf.Data()[i];
             error_ptr &= (sizeof(error_buf)-1);
         }
-        push_back = '\0';
-
-        debug_buf[debug_ptr].c     = (char)ch;
+        debug_buf[debug_ptr].c     = mf.Data()[tok.offset];
         debug_buf[debug_ptr].state = state;
         debug_ptr++;
         debug_ptr &= (nbrof(debug_buf)-1);
 
-        // State machine
-        old_state = state;
-        if( ch == '{' && (
-                                state!=HEADER     &&
-                                state!=IN_COMMENT &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                         )
-          )
-        {
-            save_state = state;
-            comment_ch = '{';
-            state = IN_COMMENT;
-        }
-        else if( ch == ';' && (
-                                state!=HEADER     &&
-                                state!=IN_COMMENT &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                              )
-               )
-        {
-            save_state = state;
-            comment_ch = ';';
-            state = IN_COMMENT;
-        }
-        else if( state==IN_COMMENT &&
-                    (
-                        (comment_ch=='{' && ch=='}') ||
-                        (comment_ch==';' && ch!=';' && previous_ch=='\n')
-                    )
-               )
-        {
-            if( comment_ch == ';' )
-                push_back = ch;
-            comment_buf[len] = '\0';
-            state = save_state;
-        }
-        else if( ch == '$' && (
-                                state!=HEADER     &&
-                                state!=IN_COMMENT &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                         )
-          )
-        {
-            save_state = state;
-            state = IN_DOLLAR;
-            nag_value = 0;
-        }
-        else if( state==IN_DOLLAR && isascii(ch) && isdigit(ch) )
-        {
-            nag_value = nag_value*10+(ch-'0');
-        }
-        else if( state==IN_DOLLAR && isascii(ch) && !isdigit(ch) )
-        {
-        /*  const char *nag_array[] =
-            {
-                "",
-                " !",     // $1
-                " ?",     // $2
-                " !!",    // $3
-                " ??",    // $4
-                " !?",    // $5
-                " ?!",    // $6
-                "",       // $7
-                "",       // $8
-                " ??",    // $9
-                " =",     // $10
-                " =",     // $11
-                " =",     // $12
-                "",       // $13
-                " +=",    // $14
-                " =+",    // $15
-                " +/-",   // $16
-                " -/+",   // $17
-                " +-",    // $18
-                " -+",    // $19
-                " +-",    // $20
-                " -+"     // $21
-            };   */
-            push_back = ch;
-            state = save_state;
-        }
-        else if( ch == '(' && (
-                                state!=HEADER     &&
-                                state!=IN_COMMENT &&
-                                state!=ERROR_STATE      &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                              )
-               )
-            state = Push(state);
-        else if( ch == ')' && (
-                                state!=HEADER     &&
-                                state!=IN_COMMENT &&
-                                state!=ERROR_STATE      &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                              )
-               )
-        {
-            state = Pop();
-        }
-        else
+        // After an error, skip to the next game
+        if( state==ERROR_STATE && tok.type!=PGN_TOKEN_TAG )
+            continue;
+        switch( tok.type )
         {
+            default: break;     // comments, NAGs, !? etc. are of no interest
 
-            switch( state )
+            // A tag after some moves starts a new game
+            case PGN_TOKEN_TAG:
             {
-                case IN_COMMENT:
-                {
-                    if( len < sizeof(comment_buf)-3 )
-                    {
-                        if( comment_ch == '{' )
-                            comment_buf[len++] = (char)ch;
-                        else
-                        {
-                            if( ch!=';' || previous_ch!='\n' )
-                                comment_buf[len++] = (char)ch;
-                        }
-                    }
-                    break;
-                }
-
-                case INIT:
+                if( state != PREFIX )
                 {
-                    push_back = ch;
+                    GameOver();
+                    GameBegin();
                     state = PREFIX;
-                    break;
-                }
-
-                case PREFIX:
-                {
-                    if( ch == '[' )
-                    {
-                        state = HEADER;
-                        push_back = ch;
-                    }
-                    else if( isascii(ch) && isdigit(ch) )
-                    {
-                        push_back = ch;
-                        state = MOVE_NUMBER;
-                    }
-                    else if( ch == '*' )
-                    {
-                        push_back = ch;
-                        state = MOVE_NUMBER;
-                    }
-                    break;
-                }
-
-                case HEADER:
-                {
-                    if( len < BOOK_BUFLEN )
-                        buf[len++] = (char)ch;
-                    if( ch == ']' )
-                        state = PREFIX;
-                    break;
-                }
-
-                case MOVE_NUMBER:
-                {
-                    if( ch=='.' || ch==' ' || ch=='\t' || ch=='\n' )
-                    {
-                        buf[len] = '\0';
-                        len = 0;
-                        if( TestResult(buf) )
-                            state = PREFIX;
-                        else if( (move_number=atoi(buf)) > 0 )
-                        {
-                            state = POST_MOVE_NUMBER;
-                            if( ch == '.' )
-                                push_back = ch;
-                        }
-                        else
-                        {
-                            Error( "Bad move number" );
-                            state = ERROR_STATE;
-                        }
-                    }
-                    else
-                    {
-                        if( len < BOOK_BUFLEN )
-                            buf[len++] = (char)ch;
-                        else
-                        {
-                            Error( "Internal buffer overflow" );
-                            state = ERROR_STATE;
-                        }
-                    }
-                    break;
-                }
-
-                case POST_MOVE_NUMBER:
-                {
-                    if( ch == '.' )
-                        state = POST_MOVE_NUMBER_HAVE_PERIOD;
-                    else if( ch!=' ' && ch!='\t' && ch!='\n' )
-                    {
-                        Error( "Bad move number" );
-                        state = ERROR_STATE;
-                    }
-                    break;
-                }
-
-                case POST_MOVE_NUMBER_HAVE_PERIOD:
-                {
-                    if( ch == '.' )
-                        state = POST_MOVE_NUMBER_BLACK;
-                    else
-                    {
-                        push_back = ch;
-                        state = PRE_MOVE_WHITE;
-                    }
-                    break;
                 }
+                len = tok.len<BOOK_BUFLEN ? tok.len : BOOK_BUFLEN;
+                memcpy( buf, tok.txt, len );
+                buf[len] = '\0';
+                Header( buf );
+                break;
+            }
 
-                case POST_MOVE_NUMBER_BLACK:
+            // So does a result
+            case PGN_TOKEN_RESULT:
+            {
+                GameOver();
+                GameBegin();
+                state = PREFIX;
+                break;
+            }
+            case PGN_TOKEN_MOVE_NUMBER:
+            {
+                move_number = tok.value;
+                if( move_number <= 0 )
                 {
-                    if( ch != '.' )
-                    {
-                        push_back = ch;
-                        state = PRE_MOVE_BLACK;
-                    }
-                    break;
+                    Error( "Bad move number" );
+                    state = ERROR_STATE;
                 }
-
-                case ERROR_STATE:
+                else
+                    state = (tok.black ? PRE_MOVE_BLACK : PRE_MOVE_WHITE);
+                break;
+            }
+            case PGN_TOKEN_SAN:
+            {
+                if( state==BETWEEN_MOVES && move_number>0 )
                 {
-                    if( ch == '[' )
-                    {
-                        push_back = ch;
-                        state = PREFIX;
-                    }
-                    break;
+                    move_number++;      // white move without a move number
+                    state = PRE_MOVE_WHITE;
                 }
-
-                case PRE_MOVE_WHITE:
-                case PRE_MOVE_BLACK:
-                {
-                    if( ch == '[' )
-                    {
-                        push_back = ch;
-                        state = PREFIX;
-                    }
-                    else if( isascii(ch) && isdigit(ch) )
-                    {
-                        push_back = ch;
-                        state = MOVE_NUMBER;
-                    }
-                    else if( ch!=' ' && ch!='\t' && ch!='\n' )
-                    {
-                        push_back = ch;
-                        state = (state==PRE_MOVE_WHITE?IN_MOVE_WHITE:IN_MOVE_BLACK);
-                    }
+                if( state!=PRE_MOVE_WHITE && state!=PRE_MOVE_BLACK )
                     break;
-                }
-
-                case IN_MOVE_WHITE:
-                case IN_MOVE_BLACK:
+                if( !DoMove(state==PRE_MOVE_WHITE,move_number,tok.txt) )
+                    state = ERROR_STATE;
+                else
+                    state = (state==PRE_MOVE_WHITE?PRE_MOVE_BLACK:BETWEEN_MOVES);
+                break;
+            }
+            case PGN_TOKEN_VARIATION_START:
+            {
+                if( stack_idx+1 >= nbrof(stack_array) )
                 {
-                    if( ch == '[' )
-                    {
-                        push_back = ch;
-                        state = PREFIX;
-                    }
-                    else if( ch==' ' || ch=='\t' || ch=='\n' || ch=='(' || ch==')' || ch=='{' || ch=='}' || ch=='$' )
-                    {
-                        buf[len] = '\0';
-                        len = 0;
-                        if( TestResult(buf) )
-                            state = PREFIX;
-                        else if( !DoMove(state==IN_MOVE_WHITE,move_number,buf) )
-                            state = ERROR_STATE;
-                        else
-                            state = (state==IN_MOVE_WHITE?PRE_MOVE_BLACK:BETWEEN_MOVES);
-                        if( ch=='(' || ch==')' || ch=='{' || ch=='}' || ch=='?' )
-                            push_back = ch;
-                    }
-                    else
-                    {
-                        if( len < BOOK_BUFLEN )
-                            buf[len++] = (char)ch;
-                        else
-                        {
-                            Error( "Internal buffer overflow" );
-                            state = ERROR_STATE;
-                        }
-                    }
-                    break;
+                    Error( "Too deep" );
+                    state = ERROR_STATE;
                 }
-
-                case BETWEEN_MOVES:
+                else
                 {
-                    if( ch == '[' )
-                    {
-                        push_back = ch;
-                        state = PREFIX;
-                    }
-                    else if( isascii(ch) && isdigit(ch) )
-                    {
-                        push_back = ch;
-                        state = MOVE_NUMBER;
-                    }
-                    break;
+                    stack_array[stack_idx].move_number = move_number;
+                    state = Push(state);
                 }
+                break;
             }
-        }
-
-        // State changes
-        if( state != old_state )
-        {
-            //fprintf( debug_log_file(), "State change %s->%s\n", ShowState(old_state), ShowState(state) );
-            if( old_state == HEADER )
-            {
-                buf[len++] = '\0';
-                Header( buf );
-            }
-            if( state==HEADER || state==IN_COMMENT || state==MOVE_NUMBER || state==IN_MOVE_WHITE || state==IN_MOVE_BLACK )
-                len=0;
-            if( state==PREFIX && (
-                                    //old_state==IN_COMMENT ||
-                                    old_state==BETWEEN_MOVES ||
-                                    old_state==MOVE_NUMBER ||
-                                    old_state==POST_MOVE_NUMBER ||
-                                    old_state==POST_MOVE_NUMBER_HAVE_PERIOD ||
-                                    old_state==POST_MOVE_NUMBER_BLACK ||
-                                    old_state==PRE_MOVE_WHITE ||
-                                    old_state==PRE_MOVE_BLACK ||
-                                    old_state==IN_MOVE_WHITE  ||
-                                    old_state==IN_MOVE_BLACK
-                                 )
-              )
-            {
-                GameOver();
-            }
-            if( state==PREFIX && old_state!=HEADER && old_state!=IN_COMMENT )
+            case PGN_TOKEN_VARIATION_END:
             {
-                GameBegin();
+                state = Pop();
+                if( state != ERROR_STATE )
+                    move_number = stack_array[stack_idx].move_number;
+                break;
             }
         }
-
-        // Next character
-        previous_ch = ch;
-        if( push_back )
-            ch = push_back;
-        else
-        {
-            ch = fgetc(infile);
-            if( ch==EOF &&  (
-                                state==MOVE_NUMBER ||
-                                state==POST_MOVE_NUMBER ||
-                                state==POST_MOVE_NUMBER_HAVE_PERIOD ||
-                                state==POST_MOVE_NUMBER_BLACK ||
-                                state==PRE_MOVE_WHITE ||
-                                state==PRE_MOVE_BLACK ||
-                                state==BETWEEN_MOVES
-                            )
-              )
-                GameOver();
-        }
     }
+    if( !aborted && (state==PRE_MOVE_WHITE || state==PRE_MOVE_BLACK || state==BETWEEN_MOVES) )
+        GameOver();
     FileOver();
     return aborted;
 }
@@ -811,7 +528,7 @@ void Book::FatalError( const char *msg )
     #endif
 } */
 
-bool Book::DoMove( bool white_, int move_number, char *buf )
+bool Book::DoMove( bool white_, int move_number, const char *buf )
 {
     #ifdef REGENERATE
     if( move_number==1 && white_ )
@@ -136,6 +136,7 @@ private:
     {
         STATE                   state;
         thc::ChessPosition      position;
+        int                     move_number;
         int                     nbr_moves;
         thc::Move               big_move_array[1000];
     };
@@ -157,7 +158,7 @@ private:
     STATE Push( STATE in );
     STATE Pop();
     void Header( char *buf );
-    bool DoMove( bool white, int move_number, char *buf );
+    bool DoMove( bool white, int move_number, const char *buf );
     void GameBegin();
     void GameOver();
     void FileOver();
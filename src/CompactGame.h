@@ -11,6 +11,7 @@
 #include <memory>
 #include "thc.h"
 #include "Roster.h"
+#include "SlimPosition.h"
 
 class GameDocument;
 
@@ -35,7 +36,7 @@ public:
     // Return index into vector where start position found
     bool FindPositionInGame( uint64_t hash_to_match, int &idx )
     {
-        thc::ChessRules cr = GetStartPosition();
+        SlimPosition cr( GetStartPosition() );
         size_t len = moves.size();
         uint64_t hash = cr.Hash64Calculate();
         bool found = (hash==hash_to_match);
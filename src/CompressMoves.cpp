@@ -7,7 +7,13 @@
 #include <algorithm>
 #include <vector>
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <chrono>
 #include "CompressMoves.h"
+#include "BitboardPosition.h"
+#include "SlimPosition.h"
 #include "DebugPrintf.h"
 
 #define DIAG_ONLY(x)
@@ -103,6 +109,32 @@ void CompressMovesDiagEnd()
     cprintf( "nbr games_with_two_queens = %lu\n",     nbr_games_with_two_queens );
 }
 
+// Decode every blob (games from the standard starting position) passes times,
+//  return the decode rate in moves per second
+double CompressMovesDecodeBenchmark( const std::vector<std::string> &blobs, int passes )
+{
+    unsigned long nbr_moves = 0;
+    unsigned long check = 0;    // so the optimiser can't skip anything
+    auto begin = std::chrono::steady_clock::now();
+    for( int pass=0; pass<passes; pass++ )
+    {
+        for( const std::string &blob: blobs )
+        {
+            CompressMoves press;
+            std::string moves_in(blob);
+            std::vector<thc::Move> moves = press.Uncompress(moves_in);
+            nbr_moves += moves.size();
+            if( moves.size() > 0 )
+                check += moves.back().dst;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(end-begin).count();
+    double rate = secs>0.0 ? nbr_moves/secs : 0.0;
+    cprintf( "CompressMovesDecodeBenchmark: %lu moves in %.3f seconds, %.0f moves/s (check %lu)\n", nbr_moves, secs, rate, check );
+    return rate;
+}
+
 
 // The ALLOW_CASTLING_EVEN_AFTER_KING_AND_ROOK_MOVES algorithm
 //  anticipates future optimised implementations - Such implementations
@@ -173,6 +205,61 @@ void CompressMovesDiagEnd()
 #define N_HI                8     // CODE_KNIGHT encodes 8 vectors for each of 2 knights (HI and LO)
 #define N_LO                0
 
+// Fast mode decoding is table driven. For each piece class a table maps the low
+//  nibble of the code and the source square to the destination square. The
+//  tables are generated at compile time from the same geometry the encoder uses
+//  (the results are masked to stay on the board, so even a corrupt code can't
+//  send us off the edge of cr.squares[])
+constexpr int FastKingDelta( int lo )
+{
+    return lo==K_VECTOR_N ? -8 : lo==K_VECTOR_NE ? -7 : lo==K_VECTOR_E ? 1 : lo==K_VECTOR_SE ? 9 :
+           lo==K_VECTOR_S ?  8 : lo==K_VECTOR_SW ?  7 : lo==K_VECTOR_W ? -1 : lo==K_VECTOR_NW ? -9 :
+           lo==K_K_CASTLING ? 2 : lo==K_Q_CASTLING ? -2 : 0;
+}
+
+constexpr int FastKnightDelta( int lo )
+{
+    return (lo&7)==N_VECTOR_NNE ? -15 : (lo&7)==N_VECTOR_NEE ? -6 : (lo&7)==N_VECTOR_SEE ? 10 : (lo&7)==N_VECTOR_SSE ? 17 :
+           (lo&7)==N_VECTOR_SSW ?  15 : (lo&7)==N_VECTOR_SWW ?  6 : (lo&7)==N_VECTOR_NWW ? -10 : -17;
+}
+
+constexpr int FastPawnDelta( int white, int lo )     // white, black is the mirror image
+{
+    return (white ? -1 : 1) * ( lo==P_DOUBLE ? 16 : lo<4 ? (lo==P_SINGLE ? 8 : lo==P_LEFT ? 9 : 7)
+                                                         : ((lo>>2)==P_SINGLE ? 8 : (lo>>2)==P_LEFT ? 9 : 7) );
+}
+
+constexpr unsigned char FastKingDst( int lo, int src )   { return static_cast<unsigned char>( (src + FastKingDelta(lo)) & 0x3f ); }
+constexpr unsigned char FastKnightDst( int lo, int src ) { return static_cast<unsigned char>( (src + FastKnightDelta(lo)) & 0x3f ); }
+constexpr unsigned char FastWhitePawnDst( int lo, int src ) { return static_cast<unsigned char>( (src + FastPawnDelta(1,lo)) & 0x3f ); }
+constexpr unsigned char FastBlackPawnDst( int lo, int src ) { return static_cast<unsigned char>( (src + FastPawnDelta(0,lo)) & 0x3f ); }
+
+// Rank or file, same file as src with rank from code, or same rank as src with file from code
+constexpr unsigned char FastRookDst( int lo, int src )
+{
+    return static_cast<unsigned char>( (lo&R_RANK) ? (((lo<<3)&0x38) | (src&7)) : ((src&0x38) | (lo&7)) );
+}
+
+// Diagonal, FALL\ or RISE/ through src, destination file from code
+constexpr unsigned char FastBishopDst( int lo, int src )
+{
+    return static_cast<unsigned char>( ( (lo&B_FALL) ? src + 9*((lo&7)-(src&7)) : src - 7*((lo&7)-(src&7)) ) & 0x3f );
+}
+
+#define FAST_DST_8(f,lo,n)  f(lo,n), f(lo,n+1), f(lo,n+2), f(lo,n+3), f(lo,n+4), f(lo,n+5), f(lo,n+6), f(lo,n+7)
+#define FAST_DST_64(f,lo)   { FAST_DST_8(f,lo,0),  FAST_DST_8(f,lo,8),  FAST_DST_8(f,lo,16), FAST_DST_8(f,lo,24), \
+                              FAST_DST_8(f,lo,32), FAST_DST_8(f,lo,40), FAST_DST_8(f,lo,48), FAST_DST_8(f,lo,56) }
+#define FAST_DST_TABLE(f)   { FAST_DST_64(f,0),  FAST_DST_64(f,1),  FAST_DST_64(f,2),  FAST_DST_64(f,3),  \
+                              FAST_DST_64(f,4),  FAST_DST_64(f,5),  FAST_DST_64(f,6),  FAST_DST_64(f,7),  \
+                              FAST_DST_64(f,8),  FAST_DST_64(f,9),  FAST_DST_64(f,10), FAST_DST_64(f,11), \
+                              FAST_DST_64(f,12), FAST_DST_64(f,13), FAST_DST_64(f,14), FAST_DST_64(f,15) }
+
+const unsigned char fast_king_dst[16][64]   = FAST_DST_TABLE(FastKingDst);
+const unsigned char fast_knight_dst[16][64] = FAST_DST_TABLE(FastKnightDst);
+const unsigned char fast_rook_dst[16][64]   = FAST_DST_TABLE(FastRookDst);
+const unsigned char fast_bishop_dst[16][64] = FAST_DST_TABLE(FastBishopDst);
+const unsigned char fast_pawn_dst[2][16][64] = { FAST_DST_TABLE(FastWhitePawnDst), FAST_DST_TABLE(FastBlackPawnDst) };
+
 // Pawns for each side are assigned logical numbers from 0 to nbr_pawns-1
 //  The ordering of the numbers is determined by consulting this table...
 static int pawn_ordering[64] =
@@ -379,32 +466,36 @@ std::vector<thc::Move> CompressMoves::Uncompress( std::string &moves_in )
 
 std::string CompressMoves::ToNaturalMoves( const std::string& moves_in, const std::string& result )
 {
-    int nbr = 1;
-    int col = 0;
     std::string s;
+    ToNaturalMoves( moves_in.c_str(), moves_in.size(), result, s );
+    return s;
+}
+
+// Append the natural (SAN) movetext of a game to out. Nothing is cleared, so a caller
+//  exporting many games can reuse one large buffer and avoid per game allocations
+void CompressMoves::ToNaturalMoves( const char *moves_in, size_t len, const std::string& result, std::string &out )
+{
+    int nbr = 1;
+    size_t col = 0;
+    std::string san_move;
     sides[0].fast_mode = false;
     sides[1].fast_mode = false;
-    int len = moves_in.size();
-    for( int i = 0; i < len; i++)
+    for( size_t i = 0; i < len; i++)
     {
         Side* side = cr.white ? &sides[0] : &sides[1];
         Side* other = cr.white ? &sides[1] : &sides[0];
         char code = moves_in[i];
         thc::Move mv;
         bool have_san_move = false;
-        size_t san_move_len = 0;
-        std::string san_move;
         if( side->fast_mode )
         {
             mv = UncompressFastMode(code, side, other, san_move);
-            san_move_len = san_move.length();
-            have_san_move = san_move_len > 0;
+            have_san_move = san_move.length() > 0;
         }
         else if(TryFastMode(side))
         {
             mv = UncompressFastMode(code, side, other, san_move);
-            san_move_len = san_move.length();
-            have_san_move = san_move_len > 0;
+            have_san_move = san_move.length() > 0;
         }
         else
         {
@@ -413,62 +504,60 @@ std::string CompressMoves::ToNaturalMoves( const std::string& moves_in, const st
         }
         if( cr.white )
         {
-            char buf[40];
-            _itoa(nbr++, buf, 10);
-            std::string t(buf);
-            t += ".";
-            if( col + t.length() >= WRAP_COLUMN )
+            char buf[20];
+            size_t buf_len = sprintf( buf, "%d.", nbr++ );
+            if( col + buf_len >= WRAP_COLUMN )
             {
-                s += EOL;
+                out += EOL;
                 col = 0;
             }
             if( col != 0 )
             {
-                s += ' ';
+                out += ' ';
                 col++;
             }
-            s += t;
-            col += t.length();
+            out.append( buf, buf_len );
+            col += buf_len;
         }
-
-        std::string t = have_san_move ? san_move : mv.NaturalOut(&cr);
+        if( !have_san_move )
+            san_move = mv.NaturalOut(&cr);
         cr.PlayMove(mv);
 
         // Final move of the game gives check, is it mate ?
+        size_t san_move_len = san_move.length();
         if( have_san_move && i+1==len && san_move[san_move_len-1]=='+' )
         {
             thc::TERMINAL score_terminal;
             cr.Evaluate( score_terminal );
             if( score_terminal == thc::TERMINAL_WCHECKMATE || score_terminal == thc::TERMINAL_BCHECKMATE )
-                t[san_move_len-1] = '#';
+                san_move[san_move_len-1] = '#';
         }
 
-        if( col + t.length() >= WRAP_COLUMN )
+        if( col + san_move_len >= WRAP_COLUMN )
         {
-            s += EOL;
+            out += EOL;
             col = 0;
         }
         if( col != 0 )
         {
-            s += ' ';
+            out += ' ';
             col++;
         }
-        s += t;
-        col += t.length();
+        out += san_move;
+        col += san_move_len;
     }
     if( col + result.length() >= WRAP_COLUMN )
     {
-        s += EOL;
+        out += EOL;
         col = 0;
     }
     if( col != 0 )
     {
-        s += ' ';
+        out += ' ';
         col++;
     }
-    s += result;
-    s += EOL;
-    return s;
+    out += result;
+    out += EOL;
 }
 
 char CompressMoves::CompressMove( thc::Move mv )
@@ -515,6 +604,245 @@ thc::Move CompressMoves::UncompressMove( char c )
     return mv;
 }
 
+void CompressMoves::Hash64Batch( thc::ChessPosition &cp, const char *moves_in, size_t len, std::vector<uint64_t> &hashes, std::vector<thc::Move> *moves )
+{
+    Init( cp );
+    Hash64Batch( moves_in, len, hashes, moves );
+}
+
+// Uncompress a move for the batch functions below, which play it themselves
+thc::Move CompressMoves::BatchUncompress( char code )
+{
+    Side *side  = cr.white ? &sides[0] : &sides[1];
+    Side *other = cr.white ? &sides[1] : &sides[0];
+    thc::Move mv;
+    if( side->fast_mode || TryFastMode(side) )
+        mv = UncompressFastMode(code,side,other);
+    else
+    {
+        mv = UncompressSlowMode(code);
+        other->fast_mode = false;   // force other side to reset and retry
+    }
+    return mv;
+}
+
+void CompressMoves::Hash64Batch( const char *moves_in, size_t len, std::vector<uint64_t> &hashes, std::vector<thc::Move> *moves )
+{
+    hashes.resize( len+1 );
+    if( moves )
+        moves->resize( len );
+    uint64_t hash = cr.Hash64Calculate();
+    hashes[0] = hash;
+    sides[0].fast_mode = false;
+    sides[1].fast_mode = false;
+    for( size_t i=0; i<len; i++ )
+    {
+        thc::Move mv = BatchUncompress( moves_in[i] );
+        if( moves )
+            (*moves)[i] = mv;
+        hash = PlayMoveHash( mv, hash );
+        hashes[i+1] = hash;
+    }
+}
+
+uint32_t MaterialSignature( const char *squares )
+{
+    int counts[2][6];
+    memset( counts, 0, sizeof(counts) );
+    for( int sq=0; sq<64; sq++ )
+    {
+        char c = squares[sq];
+        int side = isupper(c) ? 0 : 1;
+        switch( toupper(c) )
+        {
+            case 'P':   counts[side][MATERIAL_PAWNS]++;     break;
+            case 'N':   counts[side][MATERIAL_KNIGHTS]++;   break;
+            case 'B':   counts[side][is_dark(sq)?MATERIAL_DARK_BISHOPS:MATERIAL_LIGHT_BISHOPS]++;   break;
+            case 'D':   counts[side][MATERIAL_DARK_BISHOPS]++;  break;
+            case 'R':   counts[side][MATERIAL_ROOKS]++;     break;
+            case 'Q':   counts[side][MATERIAL_QUEENS]++;    break;
+            default:    break;
+        }
+    }
+    uint32_t signature = 0;
+    for( int side=0; side<2; side++ )
+    {
+        for( int kind=0; kind<6; kind++ )
+        {
+            int count = counts[side][kind];
+            int max = (kind==MATERIAL_PAWNS ? 15 : 3);
+            signature |= static_cast<uint32_t>(count<max?count:max) << MaterialSignatureShift(side==0,kind);
+        }
+    }
+    return signature;
+}
+
+void CompressMoves::MaterialSpans( const char *moves_in, size_t len, std::vector<MaterialSpan> &spans )
+{
+    spans.clear();
+    MaterialSpan span;
+    span.signature = MaterialSignature( cr.squares );
+    span.first_ply = 0;
+    sides[0].fast_mode = false;
+    sides[1].fast_mode = false;
+    for( size_t i=0; i<len; i++ )
+    {
+        thc::Move mv = BatchUncompress( moves_in[i] );
+        bool changed = ( isalpha(mv.capture) ||
+                         (mv.special>=thc::SPECIAL_PROMOTION_QUEEN && mv.special<=thc::SPECIAL_PROMOTION_KNIGHT) );
+        PlayMoveHash( mv, 0 );      // just for the board
+        if( changed )
+        {
+            unsigned short ply = static_cast<unsigned short>( i<0xffff ? i : 0xffff );
+            span.last_ply = ply;
+            spans.push_back( span );
+            span.signature = MaterialSignature( cr.squares );
+            span.first_ply = ply+1;
+        }
+    }
+    span.last_ply = static_cast<unsigned short>( len<0xffff ? len : 0xffff );
+    spans.push_back( span );
+}
+
+uint64_t PawnStructureHash( const char *squares )
+{
+    const Hash64Deltas &z = Hash64DeltaTable();
+    uint64_t hash = 0;
+    for( int sq=0; sq<64; sq++ )
+    {
+        char c = squares[sq];
+        if( c=='P' || c=='p' )
+            hash ^= z.delta[sq][ z.piece_idx[static_cast<unsigned char>(c)] ];
+    }
+    return hash;
+}
+
+void CompressMoves::PawnSpans( const char *moves_in, size_t len, std::vector<PawnSpan> &spans )
+{
+    spans.clear();
+    PawnSpan span;
+    span.hash = PawnStructureHash( cr.squares );
+    span.first_ply = 0;
+    sides[0].fast_mode = false;
+    sides[1].fast_mode = false;
+    for( size_t i=0; i<len; i++ )
+    {
+        thc::Move mv = BatchUncompress( moves_in[i] );
+        char piece = cr.squares[mv.src];
+        bool changed = ( piece=='P' || piece=='p' || mv.capture=='P' || mv.capture=='p' );
+        PlayMoveHash( mv, 0 );      // just for the board
+        if( changed )
+        {
+            unsigned short ply = static_cast<unsigned short>( i<0xffff ? i : 0xffff );
+            span.last_ply = ply;
+            spans.push_back( span );
+            span.hash = PawnStructureHash( cr.squares );
+            span.first_ply = ply+1;
+        }
+    }
+    span.last_ply = static_cast<unsigned short>( len<0xffff ? len : 0xffff );
+    spans.push_back( span );
+}
+
+// Make a move on cr's board and return the updated hash. Only what decoding needs is
+//  maintained; squares, who is to move, the en passant target and the king squares
+uint64_t CompressMoves::PlayMoveHash( thc::Move mv, uint64_t hash )
+{
+    const Hash64Deltas &z = Hash64DeltaTable();
+    char *squares = cr.squares;
+    int src = mv.src;
+    int dst = mv.dst;
+    char piece = squares[src];
+    cr.enpassant_target = thc::SQUARE_INVALID;
+    switch( mv.special )
+    {
+        case thc::SPECIAL_WK_CASTLING:
+            hash ^= z.castling[0];
+            squares[thc::e1] = ' ';
+            squares[thc::f1] = 'R';
+            squares[thc::g1] = 'K';
+            squares[thc::h1] = ' ';
+            cr.wking_square = thc::g1;
+            break;
+        case thc::SPECIAL_WQ_CASTLING:
+            hash ^= z.castling[1];
+            squares[thc::e1] = ' ';
+            squares[thc::d1] = 'R';
+            squares[thc::c1] = 'K';
+            squares[thc::a1] = ' ';
+            cr.wking_square = thc::c1;
+            break;
+        case thc::SPECIAL_BK_CASTLING:
+            hash ^= z.castling[2];
+            squares[thc::e8] = ' ';
+            squares[thc::f8] = 'r';
+            squares[thc::g8] = 'k';
+            squares[thc::h8] = ' ';
+            cr.bking_square = thc::g8;
+            break;
+        case thc::SPECIAL_BQ_CASTLING:
+            hash ^= z.castling[3];
+            squares[thc::e8] = ' ';
+            squares[thc::d8] = 'r';
+            squares[thc::c8] = 'k';
+            squares[thc::a8] = ' ';
+            cr.bking_square = thc::c8;
+            break;
+        case thc::SPECIAL_WEN_PASSANT:
+            hash ^= z.delta[src][1] ^ z.delta[dst][1] ^ z.delta[dst+8][7];
+            squares[src]   = ' ';
+            squares[dst]   = 'P';
+            squares[dst+8] = ' ';
+            break;
+        case thc::SPECIAL_BEN_PASSANT:
+            hash ^= z.delta[src][7] ^ z.delta[dst][7] ^ z.delta[dst-8][1];
+            squares[src]   = ' ';
+            squares[dst]   = 'p';
+            squares[dst-8] = ' ';
+            break;
+        case thc::SPECIAL_PROMOTION_QUEEN:
+        case thc::SPECIAL_PROMOTION_ROOK:
+        case thc::SPECIAL_PROMOTION_BISHOP:
+        case thc::SPECIAL_PROMOTION_KNIGHT:
+        {
+            char promoted = (mv.special==thc::SPECIAL_PROMOTION_QUEEN ? 'Q' :
+                             mv.special==thc::SPECIAL_PROMOTION_ROOK  ? 'R' :
+                             mv.special==thc::SPECIAL_PROMOTION_BISHOP? 'B' : 'N');
+            if( !cr.white )
+                promoted = tolower(promoted);
+            hash ^= z.delta[src][z.piece_idx[static_cast<unsigned char>(piece)]]
+                  ^ z.delta[dst][z.piece_idx[static_cast<unsigned char>(squares[dst])]]
+                  ^ z.delta[dst][z.piece_idx[static_cast<unsigned char>(promoted)]];
+            squares[src] = ' ';
+            squares[dst] = promoted;
+            break;
+        }
+        default:
+        {
+            int idx = z.piece_idx[static_cast<unsigned char>(piece)];
+            hash ^= z.delta[src][idx]
+                  ^ z.delta[dst][z.piece_idx[static_cast<unsigned char>(squares[dst])]]
+                  ^ z.delta[dst][idx];
+            squares[src] = ' ';
+            squares[dst] = piece;
+            if( mv.special == thc::SPECIAL_KING_MOVE )
+            {
+                if( cr.white )
+                    cr.wking_square = static_cast<thc::Square>(dst);
+                else
+                    cr.bking_square = static_cast<thc::Square>(dst);
+            }
+            else if( mv.special == thc::SPECIAL_WPAWN_2SQUARES )
+                cr.enpassant_target = static_cast<thc::Square>(dst+8);
+            else if( mv.special == thc::SPECIAL_BPAWN_2SQUARES )
+                cr.enpassant_target = static_cast<thc::Square>(dst-8);
+            break;
+        }
+    }
+    cr.Toggle();
+    return hash;
+}
+
 // A slow method of compressing a move into one byte
 //  Scheme is;
 //  1) Make a list of all legal moves in UCI text format, sorted alphabetically
@@ -535,6 +863,50 @@ thc::Move CompressMoves::UncompressMove( char c )
 //  "R6R/3Q4/1Q4Q1/4Q3/2Q4Q/Q4Q2/pp1Q4/kBNN1KB1 w - - 0 1"
 //
 
+// A move's position in TerseOut() alphabetical order; file and rank of src then dst,
+//  then promotion letter (none, b, n, q, r)
+static inline uint32_t TerseKey( thc::Move mv )
+{
+    int promo = 0;
+    switch( mv.special )
+    {
+        case thc::SPECIAL_PROMOTION_BISHOP: promo = 1;  break;
+        case thc::SPECIAL_PROMOTION_KNIGHT: promo = 2;  break;
+        case thc::SPECIAL_PROMOTION_QUEEN:  promo = 3;  break;
+        case thc::SPECIAL_PROMOTION_ROOK:   promo = 4;  break;
+        default:                                        break;
+    }
+    int src = mv.src;
+    int dst = mv.dst;
+    return ((((src%8)*8 + 7-src/8)*8 + dst%8)*8 + 7-dst/8)*8 + promo;
+}
+
+int SlowModeMoveList( const thc::ChessPosition &cp, thc::Move *moves )
+{
+    thc::Move generated[MAXMOVES];
+    int len;
+    BitboardPosition bb(cp);
+    if( bb.Supported() )
+        len = bb.GenLegalMoveList( generated );
+    else
+    {
+        thc::ChessRules cr = cp;
+        thc::MOVELIST list;
+        cr.GenLegalMoveList( &list );
+        len = list.count;
+        for( int i=0; i<len; i++ )
+            generated[i] = list.moves[i];
+    }
+
+    // Sort (key,index) pairs packed into one integer, rather than strings
+    uint32_t order[MAXMOVES];
+    for( int i=0; i<len; i++ )
+        order[i] = (TerseKey(generated[i])<<8) | i;
+    std::sort( order, order+len );
+    for( int i=0; i<len; i++ )
+        moves[i] = generated[ order[i]&0xff ];
+    return len;
+}
 
 char CompressMoves::CompressSlowMode( thc::Move mv )
 {
@@ -547,33 +919,16 @@ char CompressMoves::CompressSlowMode( thc::Move mv )
     cr.bking = 1;
     cr.bqueen = 1;
 
-    // Generate a list of all legal moves, in string form, sorted
-    std::vector<thc::Move> moves;
-    cr.GenLegalMoveList( moves );
-    std::vector<std::string> moves_alpha;
-    size_t len = moves.size();
-    for( size_t i=0; i<len; i++ )
-    {
-        #define TERSE
-        #ifdef TERSE
-        std::string s = moves[i].TerseOut();
-        #else
-        std::string s = moves[i].NaturalOut(&cr);
-        #endif
-        moves_alpha.push_back(s);
-    }
-    std::sort( moves_alpha.begin(), moves_alpha.end() );
+    // Generate a list of all legal moves, sorted as their TerseOut() strings would be
+    thc::Move moves[MAXMOVES];
+    int len = SlowModeMoveList( cr, moves );
 
     // Find this move in the list
-    #ifdef TERSE
-    std::string the_move = mv.TerseOut();
-    #else
-    std::string the_move = mv.NaturalOut(&cr);
-    #endif
-    size_t idx=256;  // so that error if not found
-    for( size_t i=0; i<len; i++ )
+    uint32_t the_move = TerseKey(mv);
+    int idx=256;  // so that error if not found
+    for( int i=0; i<len; i++ )
     {
-        if( moves_alpha[i] == the_move )
+        if( TerseKey(moves[i]) == the_move )
         {
             idx = i;
             break;
@@ -802,7 +1157,10 @@ char CompressMoves::CompressFastMode( thc::Move mv, Side *side, Side *other )
             //  its place, and the possibility that we cannot remain in fast mode
             //  (because we now have too many queens or other pieces). If the reset
             //  and retry fails this side will generate slow mode moves but keep
-            //  retrying until fast is possible again.
+            //  retrying until fast is possible again. Compressed moves carry no
+            //  format version (neither per game nor in the .tdb header) so this
+            //  fallback is part of the format, tracking extra promoted pieces in
+            //  fast mode instead would need such a version first.
             if( promoting )
             {
                 side->fast_mode = false;
@@ -918,37 +1276,22 @@ thc::Move CompressMoves::UncompressSlowMode( char code )
     cr.bking = 1;
     cr.bqueen = 1;
 
-    // Generate a list of all legal moves, in string form, sorted
-    std::vector<thc::Move> moves;
-    cr.GenLegalMoveList( moves );
-    std::vector<std::string> moves_alpha;
+    // Generate a list of all legal moves, sorted as their TerseOut() strings would be
+    thc::Move moves[MAXMOVES];
+    int len = SlowModeMoveList( cr, moves );
 
     // Coding scheme relies on 254 valid codes 0x02-0xff and one error code 0x01,
-    size_t len = moves.size();
-    for( size_t i=0; i<len; i++ )
-    {
-        #ifdef TERSE
-        std::string s = moves[i].TerseOut();
-        #else
-        std::string s = moves[i].NaturalOut(&cr);
-        #endif
-        moves_alpha.push_back(s);
-    }
-    std::sort( moves_alpha.begin(), moves_alpha.end() );
-
     // '\xff' (i.e. 255) is first move in list, '\fe' (i.e. 254) is second etc
     unsigned int ucode = static_cast<size_t>( code );
     ucode &= 0xff;
-    size_t idx = 255-ucode;  // 255->0, 254->1 etc.
+    int idx = 255-ucode;  // 255->0, 254->1 etc.
     if( idx >= len )
         idx = 0;    // all errors resolve to this - take first move from list
-    std::string the_move = moves_alpha[idx];
     thc::Move mv;
-    #ifdef TERSE
-    mv.TerseIn( &cr, the_move.c_str() );
-    #else
-    mv.NaturalInFast( &cr, the_move.c_str() );
-    #endif
+    if( len == 0 )
+        mv.Invalid();
+    else
+        mv = moves[idx];
     return mv;
 }
 
@@ -965,22 +1308,11 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
         {
             special = thc::SPECIAL_KING_MOVE;
             src = side->king;
-            int delta=0;
-            switch( code&0x0f )     // 0, 1, 2
-            {                       // 8, 9, 10
-                                    // 16,17,18
-                case K_VECTOR_NW:    delta = -9; break;  // 0-9
-                case K_VECTOR_N:     delta = -8; break;  // 1-9
-                case K_VECTOR_NE:    delta = -7; break;  // 2-9
-                case K_VECTOR_W:     delta = -1; break;  // 8-9
-                case K_VECTOR_E:     delta =  1; break;  // 10-9
-                case K_VECTOR_SW:    delta =  7; break;  // 16-9
-                case K_VECTOR_S:     delta =  8; break;  // 17-9
-                case K_VECTOR_SE:    delta =  9; break;  // 18-9
+            switch( code&0x0f )
+            {
                 case K_K_CASTLING:
                 {
                     special = cr.white ? thc::SPECIAL_WK_CASTLING : thc::SPECIAL_BK_CASTLING;
-                    delta = 2;
                     int rook_offset = (side->rooks[0]==src+3 ? 0 : 1);  // a rook will be 3 squares to right of king
                     side->rooks[rook_offset] = src+1;                   // that rook ends up 1 square right of king
                     // note that there is no way the rooks ordering can swap during castling
@@ -989,14 +1321,13 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
                 case K_Q_CASTLING:
                 {
                     special = cr.white ? thc::SPECIAL_WQ_CASTLING : thc::SPECIAL_BQ_CASTLING;
-                    delta = -2;
                     int rook_offset = (side->rooks[0]==src-4 ? 0 : 1);  // a rook will be 4 squares to left of king
                     side->rooks[rook_offset] = src-1;                   // that rook ends up 1 square left of king
                     // note that there is no way the rooks ordering can swap during castling
                     break;
                 }
             }
-            side->king = dst = src+delta;
+            side->king = dst = fast_king_dst[code&0x0f][src];
             break;
         }
 
@@ -1005,14 +1336,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
         {
             int rook_offset = (hi_nibble==CODE_ROOK_LO ? 0 : 1 );
             src = side->rooks[rook_offset];
-            if( code & R_RANK )                // code encodes rank ?
-            {
-                dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-            }
-            else
-            {
-                dst = (src&0x38) | (code&7);        // same rank as src, file from code
-            }
+            dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
             side->rooks[rook_offset] = dst;
 
             // swap ?
@@ -1028,11 +1352,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
         case CODE_BISHOP_DARK:
         {
             src = side->bishop_dark;
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=b8(1), dst=h2(55), file_delta=6  -> 9*6 =54
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->bishop_dark = dst;
             break;
         }
@@ -1040,11 +1360,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
         case CODE_BISHOP_LIGHT:
         {
             src = side->bishop_light;
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=g8(6), dst=a2(48), file_delta=6  -> 7*6 =42
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->bishop_light = dst;
             break;
         }
@@ -1052,10 +1368,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
         case CODE_QUEEN_ROOK:
         {
             src = side->queens[0];
-            if( code & R_RANK )                // code encodes rank ?
-                dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-            else
-                dst = (src&0x38) | (code&7);        // same rank as src, file from code
+            dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
             side->queens[0] = dst;
 
             // swap ?
@@ -1071,11 +1384,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
         case CODE_QUEEN_BISHOP:
         {
             src = side->queens[0];
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->queens[0] = dst;
 
             // swap ?
@@ -1092,21 +1401,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
         {
             int knight_offset = ((code&N_HI) ? 1 : 0 );
             src = side->knights[knight_offset];
-            int delta=0;
-            switch(code&7)          // 0, 1, 2, 3
-            {                       // 8, 9, 10,11
-                                    // 16,17,18,19
-                                    // 24,25,26,27
-                case N_VECTOR_NNE:   delta = -15;   break; // 2-17
-                case N_VECTOR_NEE:   delta = -6;    break; // 11-17
-                case N_VECTOR_SEE:   delta = 10;    break; // 27-17
-                case N_VECTOR_SSE:   delta = 17;    break; // 27-10
-                case N_VECTOR_SSW:   delta = 15;    break; // 25-10
-                case N_VECTOR_SWW:   delta = 6;     break; // 16-10
-                case N_VECTOR_NWW:   delta = -10;   break; // 0-10
-                case N_VECTOR_NNW:   delta = -17;   break; // 0-17
-            }
-            dst = src+delta;
+            dst = fast_knight_dst[code&0x0f][src];
             side->knights[knight_offset] = dst;
 
             // swap ?
@@ -1126,10 +1421,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
             else
             {
                 src = side->queens[1];
-                if( code & R_RANK )                // code encodes rank ?
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                else
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 side->queens[1] = dst;
 
                 // swap ?
@@ -1150,11 +1442,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
             else
             {
                 src = side->queens[1];
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 side->queens[1] = dst;
 
                 // swap ?
@@ -1176,37 +1464,28 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
             src = side->pawns[pawn_offset];
             bool reordering_possible = false;
             bool white = cr.white;
-            int delta=0;
+            dst = fast_pawn_dst[white?0:1][code&0x0f][src];
             switch( code&0x0f )
             {
-                case P_DOUBLE:      special = white ? thc::SPECIAL_WPAWN_2SQUARES : thc::SPECIAL_BPAWN_2SQUARES;
-                                    delta = white?-16:16; break;
-                case P_SINGLE:      delta = white?-8:8;   break;
+                case P_DOUBLE:      special = white ? thc::SPECIAL_WPAWN_2SQUARES : thc::SPECIAL_BPAWN_2SQUARES; break;
+                case P_SINGLE:      break;
                 case P_LEFT:
                 {
                     reordering_possible = true;
-                    delta = white?-9:9;
-                    if( !isalpha(cr.squares[src+delta]) )
+                    if( !isalpha(cr.squares[dst]) )
                         special = (white ? thc::SPECIAL_WEN_PASSANT : thc::SPECIAL_BEN_PASSANT);
                     break;
                 }
                 case P_RIGHT:
                 {
                     reordering_possible = true;
-                    delta = white?-7:7;
-                    if( !isalpha(cr.squares[src+delta]) )
+                    if( !isalpha(cr.squares[dst]) )
                         special = (white ? thc::SPECIAL_WEN_PASSANT : thc::SPECIAL_BEN_PASSANT);
                     break;
                 }
                 default:
                 {
                     promoting = true;
-                    switch( (code>>2)&3 )
-                    {
-                        case P_SINGLE:     delta = white?-8:8;   break;
-                        case P_LEFT:       delta = white?-9:9;   break;
-                        case P_RIGHT:      delta = white?-7:7;   break;
-                    }
                     switch( code&3 )
                     {
                         case P_QUEEN:      special = thc::SPECIAL_PROMOTION_QUEEN;    break;
@@ -1217,7 +1496,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
                     break;
                 }
             }
-            side->pawns[pawn_offset] = dst = src+delta;
+            side->pawns[pawn_offset] = dst;
 
             // If promoting piece, force a reset and retry next time for this side. This
             //  way we accommodate our pawn disappearing, and a new piece appearing in
@@ -1320,9 +1599,12 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other
     return mv;
 }
 
-namespace thc
+// Are two squares a knight's move apart ?
+static inline bool KnightMoveApart( int a, int b )
 {
-    extern const lte *knight_lookup[];
+    int df = (a&7) - (b&7);
+    int dr = (a>>3) - (b>>3);
+    return df*df + dr*dr == 5;
 }
 
 // Set flag if piece on 'from' attacks a piece on 'to', along offset_type ray
@@ -1373,24 +1655,13 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
         {
             special = thc::SPECIAL_KING_MOVE;
             src = side->king;
-            int delta=0;
             bool castling = false;
             int attack_sq=0;
-            switch( code&0x0f )     // 0, 1, 2
-            {                       // 8, 9, 10
-                                    // 16,17,18
-                case K_VECTOR_NW:    delta = -9; break;  // 0-9
-                case K_VECTOR_N:     delta = -8; break;  // 1-9
-                case K_VECTOR_NE:    delta = -7; break;  // 2-9
-                case K_VECTOR_W:     delta = -1; break;  // 8-9
-                case K_VECTOR_E:     delta =  1; break;  // 10-9
-                case K_VECTOR_SW:    delta =  7; break;  // 16-9
-                case K_VECTOR_S:     delta =  8; break;  // 17-9
-                case K_VECTOR_SE:    delta =  9; break;  // 18-9
+            switch( code&0x0f )
+            {
                 case K_K_CASTLING:
                 {
                     special = cr.white ? thc::SPECIAL_WK_CASTLING : thc::SPECIAL_BK_CASTLING;
-                    delta = 2;
                     int rook_offset = (side->rooks[0]==src+3 ? 0 : 1);  // a rook will be 3 squares to right of king
                     side->rooks[rook_offset] = src+1;                   // that rook ends up 1 square right of king
                     // note that there is no way the rooks ordering can swap during castling
@@ -1402,7 +1673,6 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
                 case K_Q_CASTLING:
                 {
                     special = cr.white ? thc::SPECIAL_WQ_CASTLING : thc::SPECIAL_BQ_CASTLING;
-                    delta = -2;
                     int rook_offset = (side->rooks[0]==src-4 ? 0 : 1);  // a rook will be 4 squares to left of king
                     side->rooks[rook_offset] = src-1;                   // that rook ends up 1 square left of king
                     // note that there is no way the rooks ordering can swap during castling
@@ -1412,7 +1682,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
                     break;
                 }
             }
-            side->king = dst = src+delta;
+            side->king = dst = fast_king_dst[code&0x0f][src];
 
             // Test whether the King is giving check directly (castling only) and/or discovering an attack by a Queen, Rook or Bishop
             bool check = false;
@@ -1452,14 +1722,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
             bool ambig = false;
             int rook_offset = (hi_nibble==CODE_ROOK_LO ? 0 : 1 );
             src = side->rooks[rook_offset];
-            if( code & R_RANK )                // code encodes rank ?
-            {
-                dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-            }
-            else
-            {
-                dst = (src&0x38) | (code&7);        // same rank as src, file from code
-            }
+            dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
             side->rooks[rook_offset] = dst;
             int other_rook_ambig = 0;
             if( side->nbr_rooks==2 )
@@ -1529,11 +1792,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
         case CODE_BISHOP_DARK:
         {
             src = side->bishop_dark;
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=b8(1), dst=h2(55), file_delta=6  -> 9*6 =54
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->bishop_dark = dst;
 
             // Test whether the Bishop is giving check directly and/or discovering an attack by a Queen or Rook
@@ -1565,11 +1824,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
         case CODE_BISHOP_LIGHT:
         {
             src = side->bishop_light;
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=g8(6), dst=a2(48), file_delta=6  -> 7*6 =42
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->bishop_light = dst;
 
             // Test whether the Bishop is giving check directly and/or discovering an attack by a Queen or Rook
@@ -1602,10 +1857,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
         case CODE_QUEEN_ROOK:
         {
             src = side->queens[0];
-            if( code & R_RANK )                // code encodes rank ?
-                dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-            else
-                dst = (src&0x38) | (code&7);        // same rank as src, file from code
+            dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
             side->queens[0] = dst;
 
             // swap ?
@@ -1640,11 +1892,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
         case CODE_QUEEN_BISHOP:
         {
             src = side->queens[0];
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->queens[0] = dst;
 
             // swap ?
@@ -1681,21 +1929,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
             bool ambig = false;
             int knight_offset = ((code&N_HI) ? 1 : 0 );
             src = side->knights[knight_offset];
-            int delta=0;
-            switch(code&7)          // 0, 1, 2, 3
-            {                       // 8, 9, 10,11
-                                    // 16,17,18,19
-                                    // 24,25,26,27
-                case N_VECTOR_NNE:   delta = -15;   break; // 2-17
-                case N_VECTOR_NEE:   delta = -6;    break; // 11-17
-                case N_VECTOR_SEE:   delta = 10;    break; // 27-17
-                case N_VECTOR_SSE:   delta = 17;    break; // 27-10
-                case N_VECTOR_SSW:   delta = 15;    break; // 25-10
-                case N_VECTOR_SWW:   delta = 6;     break; // 16-10
-                case N_VECTOR_NWW:   delta = -10;   break; // 0-10
-                case N_VECTOR_NNW:   delta = -17;   break; // 0-17
-            }
-            dst = src+delta;
+            dst = fast_knight_dst[code&0x0f][src];
             side->knights[knight_offset] = dst;
 
             int other_knight=0;
@@ -1704,17 +1938,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
                 // Set ambig flag if the other king can go to ('attacks') the dst square too
                 int other_offset = ((code&N_HI) ? 0 : 1 );
                 other_knight = side->knights[other_offset];
-                const unsigned char *ptr = thc::knight_lookup[dst];
-                unsigned char nbr_moves = *ptr++;
-                while( nbr_moves-- )
-                {
-                    unsigned char sq = *ptr++;
-                    if( sq == (unsigned char)other_knight )
-                    {
-                        ambig = true;
-                        break;
-                    }
-                }
+                ambig = KnightMoveApart( dst, other_knight );
                 if( ambig )
                 {
                     int our_king_sq = cr.white ? cr.wking_square : cr.bking_square;
@@ -1741,17 +1965,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
             int king_sq = cr.white ? cr.bking_square : cr.wking_square;   // the other king
 
             // Direct check ?
-            const unsigned char *ptr = thc::knight_lookup[king_sq];
-            unsigned char nbr_moves = *ptr++;
-            while( nbr_moves-- )
-            {
-                unsigned char sq = *ptr++;
-                if( sq == (unsigned char)dst )
-                {
-                    check = true;
-                    break;
-                }
-            }
+            check = KnightMoveApart( king_sq, dst );
 
             // Discovered check ?
             if( !check )    // no need to test for discovery if already found direct attack
@@ -1790,10 +2004,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
             else
             {
                 src = side->queens[1];
-                if( code & R_RANK )                // code encodes rank ?
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                else
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 side->queens[1] = dst;
 
                 // swap ?
@@ -1816,11 +2027,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
             else
             {
                 src = side->queens[1];
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 side->queens[1] = dst;
 
                 // swap ?
@@ -1843,19 +2050,17 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
             src = side->pawns[pawn_offset];
             bool reordering_possible = false;
             bool white = cr.white;
-            int delta=0;
+            dst = fast_pawn_dst[white?0:1][code&0x0f][src];
             char promotion_char = 0;
             bool enpassant = false;
             switch (code&0x0f)
             {
-                case P_DOUBLE:      special = white ? thc::SPECIAL_WPAWN_2SQUARES : thc::SPECIAL_BPAWN_2SQUARES;
-                    delta = white?-16:16; break;
-                case P_SINGLE:      delta = white?-8:8;   break;
+                case P_DOUBLE:      special = white ? thc::SPECIAL_WPAWN_2SQUARES : thc::SPECIAL_BPAWN_2SQUARES; break;
+                case P_SINGLE:      break;
                 case P_LEFT:
                 {
                     reordering_possible = true;
-                    delta = white?-9:9;
-                    if(!isalpha(cr.squares[src+delta]))
+                    if(!isalpha(cr.squares[dst]))
                     {
                         special = (white ? thc::SPECIAL_WEN_PASSANT : thc::SPECIAL_BEN_PASSANT);
                         enpassant = true;
@@ -1865,8 +2070,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
                 case P_RIGHT:
                 {
                     reordering_possible = true;
-                    delta = white?-7:7;
-                    if(!isalpha(cr.squares[src+delta]))
+                    if(!isalpha(cr.squares[dst]))
                     {
                         special = (white ? thc::SPECIAL_WEN_PASSANT : thc::SPECIAL_BEN_PASSANT);
                         enpassant = true;
@@ -1875,12 +2079,6 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
                 }
                 default:
                 {
-                    switch ((code>>2)&3)
-                    {
-                        case P_SINGLE:     delta = white?-8:8;   break;
-                        case P_LEFT:       delta = white?-9:9;   break;
-                        case P_RIGHT:      delta = white?-7:7;   break;
-                    }
                     switch (code&3)
                     {
                         case P_QUEEN:      special = thc::SPECIAL_PROMOTION_QUEEN;    promotion_char='Q'; break;
@@ -1891,7 +2089,7 @@ thc::Move CompressMoves::UncompressFastMode( char code, Side *side, Side *other,
                     break;
                 }
             }
-            side->pawns[pawn_offset] = dst = src+delta;
+            side->pawns[pawn_offset] = dst;
 
             // If promoting piece, force a reset and retry next time for this side. This
             //  way we accommodate our pawn disappearing, and a new piece appearing in
@@ -32,6 +32,54 @@ struct Side
     int nbr_dark_bishops;   // 0 or 1
 };
 
+// Fast mode decode tables, destination square indexed by the low nibble of the
+//  code and the source square. Queens use the rook and bishop tables, pawns are
+//  indexed by colour first (0=white, 1=black)
+extern const unsigned char fast_king_dst[16][64];
+extern const unsigned char fast_knight_dst[16][64];
+extern const unsigned char fast_rook_dst[16][64];
+extern const unsigned char fast_bishop_dst[16][64];
+extern const unsigned char fast_pawn_dst[2][16][64];
+
+// Material signature, the number of pawns (4 bits) then knights, light squared bishops,
+//  dark squared bishops, rooks and queens (2 bits each, saturating at 3) for white in
+//  the low 14 bits and for black in the next 14 bits
+#define MATERIAL_PAWNS          0
+#define MATERIAL_KNIGHTS        1
+#define MATERIAL_LIGHT_BISHOPS  2
+#define MATERIAL_DARK_BISHOPS   3
+#define MATERIAL_ROOKS          4
+#define MATERIAL_QUEENS         5
+inline int MaterialSignatureShift( bool white, int kind ) { return (white?0:14) + (kind==MATERIAL_PAWNS ? 0 : 2+2*kind); }
+inline int MaterialSignatureCount( uint32_t signature, bool white, int kind )
+{
+    return (signature >> MaterialSignatureShift(white,kind)) & (kind==MATERIAL_PAWNS ? 0x0f : 0x03);
+}
+uint32_t MaterialSignature( const char *squares );
+
+// A run of plies (positions after first_ply to last_ply moves) with the same material
+struct MaterialSpan
+{
+    uint32_t       signature;
+    unsigned short first_ply;
+    unsigned short last_ply;
+};
+
+// Pawn structure hash, the thc Zobrist hash (see SlimPosition.h) of the pawns alone
+uint64_t PawnStructureHash( const char *squares );
+
+// Position key, thc's Hash64Calculate() (and so Hash64Batch()) doesn't include the side to move
+#define HASH64_BLACK_TO_MOVE 0x9d39247e33776d41ULL
+inline uint64_t Hash64Key( uint64_t hash, bool white ) { return white ? hash : hash^HASH64_BLACK_TO_MOVE; }
+
+// A run of plies with the same pawns
+struct PawnSpan
+{
+    uint64_t       hash;
+    unsigned short first_ply;
+    unsigned short last_ply;
+};
+
 class CompressMoves
 {
 public:
@@ -58,8 +106,25 @@ public:
     std::vector<thc::Move> Uncompress( std::string &moves_in );
     std::vector<thc::Move> Uncompress( thc::ChessPosition &cp, std::string &moves_in );
     std::string ToNaturalMoves( const std::string& moves_in, const std::string& result );
+    void        ToNaturalMoves( const char *moves_in, size_t len, const std::string& result, std::string &out );
     char      CompressMove( thc::Move mv );
     thc::Move UncompressMove( char c );
+
+    // Zobrist hash (as calculated by thc Hash64Calculate() and Hash64Update()) of the
+    //  position before each move and after the last, so len+1 hashes. Moves are made on
+    //  the board directly rather than with PlayMove(), cr ends up at the final position
+    //  but without history, move counts or castling flags. Optionally the moves too
+    void Hash64Batch( const char *moves_in, size_t len, std::vector<uint64_t> &hashes, std::vector<thc::Move> *moves=NULL );
+    void Hash64Batch( thc::ChessPosition &cp, const char *moves_in, size_t len, std::vector<uint64_t> &hashes, std::vector<thc::Move> *moves=NULL );
+
+    // The material spans of a game from cr's position, in order. Material never goes
+    //  back to an earlier signature (every change is a capture or promotion) so these
+    //  are also the game's distinct signatures. cr ends up as for Hash64Batch()
+    void MaterialSpans( const char *moves_in, size_t len, std::vector<MaterialSpan> &spans );
+
+    // The pawn structure spans of a game from cr's position, in order. Pawns only move
+    //  forwards, so again these are also the game's distinct pawn structures
+    void PawnSpans( const char *moves_in, size_t len, std::vector<PawnSpan> &spans );
     CompressMoves( const CompressMoves& copy_from_me ) { cr=copy_from_me.cr; sides[0]=copy_from_me.sides[0]; sides[1]=copy_from_me.sides[1]; }
     CompressMoves & operator= (const CompressMoves & copy_from_me ) { cr=copy_from_me.cr; sides[0]=copy_from_me.sides[0]; sides[1]=copy_from_me.sides[1]; return *this; }
     void Init() { TryFastMode( &sides[0]); TryFastMode( &sides[1]); }
@@ -76,6 +141,16 @@ private:
     thc::Move UncompressSlowMode( char code );
     thc::Move UncompressFastMode( char code, Side *side, Side *other );
     thc::Move UncompressFastMode( char code, Side *side, Side *other, std::string &san_move );
+    uint64_t  PlayMoveHash( thc::Move mv, uint64_t hash );
+    thc::Move BatchUncompress( char code );
 };
 
+// Decode every blob passes times, returns the rate in moves per second
+double CompressMovesDecodeBenchmark( const std::vector<std::string> &blobs, int passes=1 );
+
+// The legal moves slow mode codes index, sorted into TerseOut() alphabetical order. Uses
+//  the bitboard generator unless the position is too strange for it. Returns the
+//  number of moves, moves needs room for MAXMOVES
+int SlowModeMoveList( const thc::ChessPosition &cp, thc::Move *moves );
+
 #endif // COMPRESS_MOVES_H
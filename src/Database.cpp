@@ -157,6 +157,7 @@ void * WorkerThread::Entry()
         {
             cprintf( "... if we waited for mutex, wait is over (%d)\n", temp );
             the_database->LoadAllGamesForPositionSearch( the_database->tiny_db.in_memory_game_cache );
+            the_database->LoadOpeningTree();
 
             // put investigation stuff here
 #ifdef DATABASE_EXPERIMENTS
@@ -455,6 +456,8 @@ wxMutex *WaitForWorkerThread( const char *title )
         {
             //static int now_before=-1;
             int now = the_database->background_load_permill;
+            if( now < base )    // loading games is done, now building the opening tree
+                base = now;
             //if( now != now_before )
             //    cprintf( "base=%d, now=%d, now-base=%d, 1000-base=%d\n", base, now, now-base, 1000-base );
             //now_before = now;
@@ -614,6 +617,41 @@ bool Database::LoadAllGamesForPositionSearch( std::vector< smart_ptr<ListableGam
     return cache_nbr>0;
 }
 
+// The opening tree is saved alongside the database (like a book's "_compiled" file)
+//  and rebuilt from the loaded games if the database is newer or has changed
+void Database::LoadOpeningTree()
+{
+    opening_tree.Clear();
+    int depth     = objs.repository->database.m_opening_tree_depth;
+    int min_games = objs.repository->database.m_opening_tree_min_games;
+    std::vector< smart_ptr<ListableGame> > &games = tiny_db.in_memory_game_cache;
+    if( depth<=0 || is_partial_load || games.size()==0 )
+        return;
+    AutoTimer at("Load opening tree");
+    std::string tree_filename = db_filename + "_tree";
+    wxFileName tf(tree_filename.c_str());
+    wxFileName df(db_filename.c_str());
+    std::string error_msg;
+    bool build = true;
+    if( tf.FileExists() && df.GetModificationTime() <= tf.GetModificationTime() )
+    {
+        build = opening_tree.Load( tree_filename, games.size(), depth, min_games, error_msg );
+        if( build )
+            cprintf( "%s, rebuilding\n", error_msg.c_str() );
+    }
+    if( build )
+    {
+        background_load_permill = 0;
+        if( opening_tree.Build( games, depth, min_games, background_load_permill, kill_background_load ) )
+        {
+            if( opening_tree.Save( tree_filename, error_msg ) )
+                cprintf( "%s\n", error_msg.c_str() );
+        }
+        else
+            opening_tree.Clear();
+    }
+}
+
 // Transform to lower case, collapse multiple spaces to 1, remove spaces after comma
 void Normalise( std::string &in, std::string &out )
 {
@@ -15,6 +15,7 @@
 #include "thc.h"
 #include "GameDocument.h"
 #include "MemoryPositionSearch.h"
+#include "OpeningTree.h"
 #include "GamesCache.h"
 
 enum DB_REQ
@@ -33,9 +34,11 @@ public:
     int  SetDbPosition(DB_REQ db_req);
     int  GetRow( int row, CompactGame *pact );
     bool LoadAllGamesForPositionSearch( std::vector< smart_ptr<ListableGame> > &mega_cache );
+    void LoadOpeningTree();
     int  FindPlayer( std::string &name, std::string &current, int start_row, bool white );
     int LoadPlayerGamesWithQuery( std::string &player_name, bool white, std::vector< smart_ptr<ListableGame> > &games );
     MemoryPositionSearch tiny_db;
+    OpeningTree opening_tree;       // next move stats for tiny_db's popular positions
     int background_load_permill;
     bool kill_background_load;
     std::string GetStatus();
@@ -16,6 +16,7 @@
 #include "AutoTimer.h"
 #include "GameDetailsDialog.h"
 #include "GamePrefixDialog.h"
+#include "SearchFilterDialog.h"
 #include "GameLogic.h"
 #include "Objects.h"
 #include "Lang.h"
@@ -23,12 +24,15 @@
 #include "CtrlChessBoard.h"
 #include "DbDialog.h"
 #include "Database.h"
+#include "DecodeCache.h"
+#include "SlimPosition.h"
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <iterator>
 #include <list>
 #include <algorithm>
+#include <limits.h>
 
 // DbDialog constructors
 DbDialog::DbDialog
@@ -52,6 +56,8 @@ DbDialog::DbDialog
     activated_at_least_once = false;
     transpo_activated = false;
     white_player_search = true;
+    streaming = false;
+    stream_pending = false;
 }
 
 void DbDialog::GdvEnumerateGames()
@@ -152,6 +158,10 @@ wxSizer *DbDialog::GdvAddExtraControls( bool WXUNUSED(big_display) )
             wxDefaultPosition, wxDefaultSize, 0 );
         gdr.RegisterPanelWindow( save_all_to_a_file );
         vsiz_panel_buttons->Add(save_all_to_a_file, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+        wxButton* search_filter = new wxButton ( this, ID_DB_UTILITY, wxT("Search filter..."),
+            wxDefaultPosition, wxDefaultSize, 0 );
+        gdr.RegisterPanelWindow( search_filter );
+        vsiz_panel_buttons->Add(search_filter, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
     }
 
     filter_ctrl = new wxCheckBox( this, ID_DB_CHECKBOX, "&Clipboard as temp database", wxDefaultPosition, wxDefaultSize, 0 );
@@ -188,6 +198,12 @@ void DbDialog::SetDialogHelp()
         FindWindow(ID_DB_SEARCH)->SetHelpText(search_help);
         FindWindow(ID_DB_SEARCH)->SetToolTip(search_help);
     }
+    else
+    {
+        wxString search_filter_help = "Restrict the games found to a minimum rating, a range of years or particular results.";
+        FindWindow(ID_DB_UTILITY)->SetHelpText(search_filter_help);
+        FindWindow(ID_DB_UTILITY)->SetToolTip(search_filter_help);
+    }
 }
 
 // Games Dialog Override - One time activation
@@ -224,6 +240,13 @@ void DbDialog::GdvReadItem( int item, CompactGame &pact )
     // Mechanism 1) Dialog presents selected games
     //  This mechanism kicks in after position/pattern/material balance searches
     bool in_memory = ReadGameFromSearchResults( item, pact );
+
+    // Near the end of the games found so far, find some more
+    if( streaming && !stream_pending && item+DB_STREAM_PREFETCH >= static_cast<int>(gc_db_displayed_games->gds.size()) )
+    {
+        stream_pending = true;
+        CallAfter( &DbDialog::StreamMoreGames, static_cast<int>(gc_db_displayed_games->gds.size())+DB_STREAM_FIRST );
+    }
     if( !in_memory )
     {
 
@@ -245,20 +268,12 @@ bool DbDialog::ReadGameFromSearchResults( int item, CompactGame &pact )
     {
         in_memory = true;
         gc_db_displayed_games->gds[item]->GetCompactGame(pact);
-        if( transpo_activated && transpositions.size() > 1 )
+        if( transpo_activated && position_stats.transpositions.size() > 1 )
         {
-            for( unsigned int j=0; j<transpositions.size(); j++ )
-            {
-                std::string &this_one = transpositions[j].blob;
-                const char *p = this_one.c_str();
-                size_t len = this_one.length();
-                std::string str_blob( gc_db_displayed_games->gds[item]->CompressedMoves() );
-                if( str_blob.length()>=len && 0 == memcmp(p,str_blob.c_str(),len) )
-                {
-                    pact.transpo_nbr = j+1;
-                    break;
-                }
-            }
+            size_t len;
+            int j = position_stats.FindTransposition( gc_db_displayed_games->gds[item]->CompressedMoves(), len );
+            if( j >= 0 )
+                pact.transpo_nbr = j+1;
         }
     }
     return in_memory;
@@ -272,8 +287,12 @@ int DbDialog::GetBasePositionIdx( CompactGame &pact, bool receiving_focus )
     {
         if( receiving_focus )
         {
-            CompressMoves press;
-            std::string moves = press.Compress( pact.moves );
+            std::string moves;
+            if( !gbl_decode_cache.Blob( pact.game_id, pact.moves, moves ) )
+            {
+                CompressMoves press;
+                moves = press.Compress( pact.moves );
+            }
             unsigned short offset1;
             unsigned short offset2;
             bool reverse;
@@ -293,18 +312,12 @@ int DbDialog::GetBasePositionIdx( CompactGame &pact, bool receiving_focus )
 int DbDialog::CalculateTranspo( const char *blob, int &transpo )
 {
     transpo = 0;
-    unsigned int sz2 = transpositions.size();
-    for( unsigned int j=0; j<sz2; j++ )
-    {
-        PATH_TO_POSITION *ptp = &transpositions[j];
-        unsigned int offset = ptp->blob.length();
-        if( 0 == memcmp( ptp->blob.c_str(), blob, offset ) )
-        {
-            transpo = j+1;
-            return offset;
-        }
-    }
-    return 0;
+    size_t len;
+    int j = position_stats.FindTransposition( blob, len );
+    if( j < 0 )
+        return 0;
+    transpo = j+1;
+    return len;
 }
 
 // Games Dialog Override - List column clicked
@@ -312,6 +325,7 @@ void DbDialog::GdvListColClick( int compare_col_ )
 {
     if( db_req == REQ_PLAYERS )
         return; // not supported
+    StreamMoreGames( INT_MAX );     // sorting needs all the games
     ColumnSort( compare_col_, gc_db_displayed_games->gds );
 }
 
@@ -349,6 +363,7 @@ void DbDialog::GdvSaveAllToAFile()
         objs.repository->nv.m_doc_dir = dir2;
         wxString wx_filename = fd.GetPath();
         std::string filename( wx_filename.c_str() );
+        StreamMoreGames( INT_MAX );
         gc_db_displayed_games->FileSaveAllAsAFile( filename );
     }
 }
@@ -514,6 +529,29 @@ void DbDialog::GdvCheckBox( bool checked )
     }
 }
 
+// ID_DB_UTILITY is Search filter
+void DbDialog::GdvUtility()
+{
+    SearchFilterDialog dialog( this );
+    dialog.dat = objs.repository->database;
+    if( wxID_OK == dialog.ShowModal() )
+    {
+        objs.repository->database = dialog.dat;
+
+        // Repeat the search in the current position (or pattern) with the new filter
+        if( db_req == REQ_PATTERN )
+        {
+            PatternSearch();
+            Goto(0); // list_ctrl->SetFocus();
+        }
+        else
+        {
+            StatsCalculate();
+            Goto(0); // list_ctrl->SetFocus();
+        }
+    }
+}
+
 // Copy to clipboard if clear_clipboard is true
 // Add to clipboard if clear_clipboard is false
 //
@@ -646,17 +684,160 @@ std::multimap<B,A> flip_and_sort_map(const std::map<A,B> &src)
     return dst;
 }
 
+// Position and pattern searches only consider games passing the Elo, year and result
+//  filter from the Search filter dialog (if any)
+static MpsFilter SearchFilter()
+{
+    const DatabaseConfig &dat = objs.repository->database;
+    MpsFilter filter;
+    filter.min_elo = dat.m_search_min_elo;
+    char buf[80];
+    if( dat.m_search_from_year > 0 )
+    {
+        sprintf( buf, "%04d.??.??", dat.m_search_from_year );
+        filter.min_date = Date2Bin(buf);
+    }
+    if( dat.m_search_to_year > 0 )
+    {
+        sprintf( buf, "%04d.12.31", dat.m_search_to_year );
+        filter.max_date = Date2Bin(buf);
+    }
+    if( !dat.m_search_white_wins || !dat.m_search_black_wins || !dat.m_search_draws || !dat.m_search_no_result )
+    {
+        filter.result_mask = (dat.m_search_no_result  ? 1<<Result2Bin("*")       : 0) |
+                             (dat.m_search_white_wins ? 1<<Result2Bin("1-0")     : 0) |
+                             (dat.m_search_black_wins ? 1<<Result2Bin("0-1")     : 0) |
+                             (dat.m_search_draws      ? 1<<Result2Bin("1/2-1/2") : 0);
+    }
+    return filter;
+}
+
+// One move in the Next Move list, from the search's stats or the opening tree
+struct NEXT_MOVE_STATS
+{
+    thc::Move  mv;
+    MOVE_STATS ms;
+    int        average_elo;     // 0 if not known
+};
+
+// Make the Next Move list, next_moves are already sorted most played first
+static void NextMoveStrings( thc::ChessRules &cr_to_match, const std::vector<NEXT_MOVE_STATS> &next_moves, thc::Move user_move,
+                             bool add_go_back, const std::string &go_back_string,
+                             std::vector<thc::Move> &moves_in_this_position, wxArrayString &strings_stats )
+{
+    moves_in_this_position.clear();
+    for( const NEXT_MOVE_STATS &nms: next_moves )
+    {
+        double percentage_score = 0.0;
+        int nbr_games      = nms.ms.nbr_games;
+        int nbr_white_wins = nms.ms.nbr_white_wins;
+        int nbr_black_wins = nms.ms.nbr_black_wins;
+        int nbr_draws      = nms.ms.nbr_draws;
+        int draws_plus_no_result = nbr_games - nbr_white_wins - nbr_black_wins;
+        if( nbr_games )
+            percentage_score = ((1.0*nbr_white_wins + 0.5*draws_plus_no_result) * 100.0) / nbr_games;
+        thc::Move mv = nms.mv;
+        if( add_go_back )
+        {
+            add_go_back = false;
+            wxString wstr( go_back_string.c_str() );
+            strings_stats.Add(wstr);
+            moves_in_this_position.push_back(mv);
+        }
+        moves_in_this_position.push_back(mv);
+        std::string s = mv.NaturalOut(&cr_to_match);
+        LangOut(s);
+        if( !cr_to_match.white )
+            s = "..." + s;
+        char buf[200];
+        sprintf( buf, "%s%s: %d %s, white scores %.1f%% +%d -%d =%d",
+                mv==user_move ? ">" : " ",
+                s.c_str(),
+                nbr_games,
+                nbr_games==1 ? "game" : "games",
+                percentage_score,
+                nbr_white_wins, nbr_black_wins, nbr_draws );
+        if( nms.average_elo > 0 )
+            sprintf( strchr(buf,'\0'), ", average Elo %d", nms.average_elo );
+        cprintf( "%s\n", buf );
+        wxString wstr(buf);
+        strings_stats.Add(wstr);
+    }
+}
+
+// Games found and results, for the title
+static std::string TotalsString( int total_games, int total_white_wins, int total_black_wins, int total_draws )
+{
+    char buf[1000];
+    int total_draws_plus_no_result = total_games - total_white_wins - total_black_wins;
+    double percent_score=0.0;
+    if( total_games )
+        percent_score= ((1.0*total_white_wins + 0.5*total_draws_plus_no_result) * 100.0) / total_games;
+    sprintf( buf, "%s%d %s, white scores %.1f%% +%d -%d =%d",
+            objs.gl->db_clipboard ? "Clipboard search: " : "",
+            total_games,
+            total_games==1 ? "game" : "games",
+            percent_score,
+            total_white_wins, total_black_wins, total_draws );
+    return std::string(buf);
+}
+
+// List the transpositions in order (they're already sorted), popular positions
+//  can have thousands so only list the most frequent
+static void TranspositionStrings( std::vector< PATH_TO_POSITION > &transpositions, wxArrayString &strings_transpos )
+{
+    cprintf( "%d transpositions\n", transpositions.size() );
+    unsigned int nbr_shown = std::min<unsigned int>( transpositions.size(), DB_TRANSPOSITIONS_SHOWN );
+    for( unsigned int j=0; j<nbr_shown; j++ )
+    {
+        PATH_TO_POSITION *p = &transpositions[j];
+        size_t len = p->blob.length();
+        CompressMoves press;
+        std::vector<thc::Move> unpacked = press.Uncompress(p->blob);
+        std::string txt;
+        thc::ChessRules cr2;
+        for( unsigned int k=0; k<len; k++ )
+        {
+            thc::Move mv = unpacked[k];
+            if( cr2.white )
+            {
+                char buf[100];
+                sprintf( buf, "%d.", cr2.full_move_count );
+                txt += buf;
+            }
+            std::string s = mv.NaturalOut(&cr2);
+            LangOut(s);
+            txt += s;
+            txt += " ";
+            cr2.PlayMove(mv);
+        }
+        char buf[2000];
+        sprintf( buf, "T%d: %s: %d occurences", j+1, txt.c_str(), p->frequency );
+        cprintf( "%s\n", buf );
+        wxString wstr(buf);
+        strings_transpos.Add(wstr);
+    }
+    if( nbr_shown < transpositions.size() )
+    {
+        int nbr_games_not_shown = 0;
+        for( unsigned int j=nbr_shown; j<transpositions.size(); j++ )
+            nbr_games_not_shown += transpositions[j].frequency;
+        char buf[200];
+        sprintf( buf, "(%u less frequent transpositions, %d occurences, not shown)",
+                    (unsigned)(transpositions.size()-nbr_shown), nbr_games_not_shown );
+        wxString wstr(buf);
+        strings_transpos.Add(wstr);
+    }
+}
+
 // Heart and soul of DbDialog() - do the search and calculate the stats
 void DbDialog::StatsCalculate()
 {
     wxString save_title = GetTitle();
     SetTitle("Searching...");
 
-    int total_white_wins = 0;
-    int total_black_wins = 0;
-    int total_draws = 0;
-    transpositions.clear();
-    stats.clear();
+    position_stats.Clear();
+    streaming = false;
     dirty = true;
     GamesCache temp;
     temp.gds.clear();
@@ -690,6 +871,52 @@ void DbDialog::StatsCalculate()
     MemoryPositionSearch *mps = &partial;
     int game_count = 0;
 
+    // Play through the current game, and find the last instance of a user move in this position
+    CompactGame pact;
+    objs.gl->gd.GetCompactGame( pact );
+    thc::Move user_move;
+    user_move.Invalid();
+    SlimPosition scan(pact.start_position);
+    for( size_t i=0; i<pact.moves.size(); i++ )
+    {
+        if( scan == cr_to_match )
+            user_move = pact.moves[i];
+        scan.PlayMove( pact.moves[i] );
+    }
+
+    // The database's popular positions are in its opening tree, in which case show the
+    //  Next Move list straight away, before searching for the games. The tree has all
+    //  the games, so it's no use if the search is filtered
+    MpsFilter filter = SearchFilter();
+    wxArrayString strings_stats;
+    const OpeningTreePosition *tree_pos = NULL;
+    if( !objs.gl->db_clipboard && !filter.IsActive() )
+        tree_pos = objs.db->opening_tree.Lookup( cr_to_match );
+    if( tree_pos )
+    {
+        std::vector<NEXT_MOVE_STATS> next_moves;
+        const OpeningTreeMove *tree_moves = objs.db->opening_tree.Moves( tree_pos );
+        for( uint32_t i=0; i<tree_pos->nbr_moves; i++ )
+        {
+            NEXT_MOVE_STATS nms;
+            nms.mv = tree_moves[i].move;
+            nms.ms.nbr_games      = tree_moves[i].nbr_games;
+            nms.ms.nbr_white_wins = tree_moves[i].white_wins;
+            nms.ms.nbr_black_wins = tree_moves[i].black_wins;
+            nms.ms.nbr_draws      = tree_moves[i].draws;
+            nms.average_elo       = tree_moves[i].average_elo;
+            next_moves.push_back( nms );
+        }
+        NextMoveStrings( cr_to_match, next_moves, user_move, add_go_back, go_back_string, moves_in_this_position, strings_stats );
+        if( list_ctrl_stats )
+        {
+            list_ctrl_stats->Clear();
+            if( !strings_stats.IsEmpty() )
+                list_ctrl_stats->InsertItems( strings_stats, 0 );
+            list_ctrl_stats->Update();
+        }
+    }
+
     // The fast MemoryPositionSearch facility was developed to scan all the games in a tiny database,
     //  but once it was available it made sense to apply it to searching for positions in any game
     //  list, in particular games from a disk based (i.e. not tiny) database and the clipboard. These
@@ -699,216 +926,90 @@ void DbDialog::StatsCalculate()
     {
         std::vector< smart_ptr<ListableGame> > *clipboard_source = &objs.gl->gc_clipboard.gds;
 
-        // The promotion attribute is only set automatically for the tiny database games (at the moment)
+        // The promotion attribute is kept once calculated (edited games recalculate it
+        //  along with their compressed moves if they've changed)
         for( size_t i=0; i<clipboard_source->size(); i++ )
-            (*clipboard_source)[i]->CalculatePromotionAttribute();
+            (*clipboard_source)[i]->EnsurePromotionAttribute();
         ProgressBar progress2("Searching Clipboard", "Searching",false);
-        game_count = mps->DoSearch(cr_to_match,&progress2,clipboard_source);
+        mps->SetFilter( filter );
+        game_count = mps->DoSearch(cr_to_match,&progress2,clipboard_source,true);
     }
     else
     {
+        // If the Next Move list came from the opening tree, the first screenful or so of
+        //  games are enough to start with, more are found as the list is scrolled
         mps = &objs.db->tiny_db;
-        bool search_needed = !mps->IsThisSearchPosition(cr_to_match);
+        mps->SetFilter( filter );
+        bool search_needed = !mps->IsThisSearchPosition(cr_to_match) || (!tree_pos && !mps->HavePositionStats());
         cprintf( "search_needed = %s\n", search_needed?"true":"false" );
-        if( search_needed )
+        if( search_needed && tree_pos )
+        {
+            mps->DoSearchStart( cr_to_match, &mps->in_memory_game_cache, true );
+            game_count = mps->DoSearchContinue( DB_STREAM_FIRST );
+        }
+        else if( search_needed )
         {
             ProgressBar progress2("Searching Database", "Searching",false);
             //progress2.DrawNow();
-            game_count = mps->DoSearch(cr_to_match,&progress2);
+            game_count = mps->DoSearch(cr_to_match,&progress2,true);
         }
+        else if( !mps->IsSearchComplete() && !tree_pos )
+            game_count = mps->DoSearchContinue( INT_MAX );
+        streaming = !mps->IsSearchComplete();
     }
 
     std::vector< smart_ptr<ListableGame> >  &db_games    = mps->GetVectorSourceGames();
     std::vector<DoSearchFoundGame>          &found_games = mps->GetVectorGamesFound();
     size_t nbr_found_games = found_games.size();
 
+    // The stats were calculated as the games were found, until all the games are found
+    //  the totals are the opening tree's
+    position_stats.Clear();
+    if( mps->HavePositionStats() )
+        position_stats = mps->GetPositionStats();
+    int total_white_wins = position_stats.total_white_wins;
+    int total_black_wins = position_stats.total_black_wins;
+    int total_draws      = position_stats.total_draws;
+    int total_games      = nbr_found_games;
+    if( streaming )
+    {
+        total_white_wins = tree_pos->white_wins;
+        total_black_wins = tree_pos->black_wins;
+        total_draws      = tree_pos->draws;
+        total_games      = tree_pos->nbr_games;
+    }
     {
-        ProgressBar progress("Calculating Stats","Calculating Stats",false);
         for( size_t i=0; i<nbr_found_games; i++ )
-        {
-            double permill = (static_cast<double>(i) * 1000.0) / static_cast<double>(nbr_found_games);
-            progress.Permill( static_cast<int>(permill) );
-            int idx                   = found_games[i].idx;
-            unsigned short offset_first = found_games[i].offset_first;
-            unsigned short offset_last  = found_games[i].offset_last;
-            temp.gds.push_back(db_games[idx]);
-            std::string blob = db_games[idx]->CompressedMoves();
-
-            // Search for a match to this game
-            bool new_transposition_found=false;
-            bool found=false;
-            int found_idx=0;
-            for( size_t j=0; !found && j<transpositions.size(); j++ )
-            {
-                size_t len = transpositions[j].blob.size();
-                if( len <= blob.size() )
-                {
-                    std::string s1 = blob.substr(0,len);
-                    std::string s2 = transpositions[j].blob;
-                    if( s1 == s2 )
-                    {
-                        found = true;
-                        found_idx = j;
-                    }
-                }
-            }
-
-            // If none so far add the one from this game
-            if( !found )
-            {
-                new_transposition_found = true;
-                PATH_TO_POSITION ptp;
-                ptp.blob = blob.substr(0,offset_first);
-                transpositions.push_back(ptp);
-                found_idx = transpositions.size()-1;
-            }
-            const char *result = db_games[idx]->Result();
-            bool white_wins = (0==strcmp(result,"1-0"));
-            if( white_wins )
-                total_white_wins++;
-            bool black_wins = (0==strcmp(result,"0-1"));
-            if( black_wins )
-                total_black_wins++;
-            bool draw       = (0==strcmp(result,"1/2-1/2"));
-            if( draw )
-                total_draws++;
-            PATH_TO_POSITION *p = &transpositions[found_idx];
-            p->frequency++;
-            if( offset_last < blob.length() ) // must be more moves
-            {
-                char compressed_move = blob[offset_last];
-                std::map< char, MOVE_STATS >::iterator it;
-                it = stats.find(compressed_move);
-                if( it == stats.end() )
-                {
-                    MOVE_STATS empty;
-                    empty.nbr_games = 0;
-                    empty.nbr_white_wins = 0;
-                    empty.nbr_black_wins = 0;
-                    empty.nbr_draws = 0;
-                    stats[compressed_move] = empty;
-                    it = stats.find(compressed_move);
-                }
-                it->second.nbr_games++;
-                if( white_wins )
-                    it->second.nbr_white_wins++;
-                else if( black_wins )
-                    it->second.nbr_black_wins++;
-                else if( draw )
-                    it->second.nbr_draws++;
-            }
+            temp.gds.push_back( db_games[found_games[i].idx] );
 
-            // For speed, have the most frequent transpositions first
-            if( new_transposition_found )
-            {
-                std::sort( transpositions.rbegin(), transpositions.rend() );
-            }
-        }
-
-        // Play through the current game, and find the last instance of a user move in this position
-        CompactGame pact;
-        objs.gl->gd.GetCompactGame( pact );
-        thc::Move user_move;
-        user_move.Invalid();
-        thc::ChessRules scan(pact.start_position);
-        for( size_t i=0; i<pact.moves.size(); i++ )
-        {
-            if( scan == cr_to_match )
-                user_move = pact.moves[i];
-            scan.PlayMove( pact.moves[i] );
-        }
-
-        // Sort the stats according to number of games
-        std::multimap< MOVE_STATS,  char > dst = flip_and_sort_map(stats);
-        std::multimap< MOVE_STATS,  char >::reverse_iterator it;
-        moves_in_this_position.clear();
-        wxArrayString strings_stats;
-        for( it=dst.rbegin(); it!=dst.rend(); it++ )
+        // Below the opening tree, sort the search's stats according to number of games
+        if( !tree_pos )
         {
-            double percentage_score = 0.0;
-            int nbr_games      = it->first.nbr_games;
-            int nbr_white_wins = it->first.nbr_white_wins;
-            int nbr_black_wins = it->first.nbr_black_wins;
-            int nbr_draws      = it->first.nbr_draws;
-            int draws_plus_no_result = nbr_games - nbr_white_wins - nbr_black_wins;
-            if( nbr_games )
-                percentage_score = ((1.0*nbr_white_wins + 0.5*draws_plus_no_result) * 100.0) / nbr_games;
-            char compressed_move = it->second;
-            CompressMoves press(cr_to_match);
-            thc::Move mv = press.UncompressMove( compressed_move );
-            if( add_go_back )
+            std::multimap< MOVE_STATS,  char > dst = flip_and_sort_map(position_stats.stats);
+            std::multimap< MOVE_STATS,  char >::reverse_iterator it;
+            std::vector<NEXT_MOVE_STATS> next_moves;
+            for( it=dst.rbegin(); it!=dst.rend(); it++ )
             {
-                add_go_back = false;
-                wxString wstr( go_back_string.c_str() );
-                strings_stats.Add(wstr);
-                moves_in_this_position.push_back(mv);
+                NEXT_MOVE_STATS nms;
+                CompressMoves press(cr_to_match);
+                nms.mv = press.UncompressMove( it->second );
+                nms.ms = it->first;
+                nms.average_elo = 0;
+                next_moves.push_back( nms );
             }
-            moves_in_this_position.push_back(mv);
-            std::string s = mv.NaturalOut(&cr_to_match);
-            LangOut(s);
-            if( !cr_to_match.white )
-                s = "..." + s;
-            char buf[200];
-            sprintf( buf, "%s%s: %d %s, white scores %.1f%% +%d -%d =%d",
-                    mv==user_move ? ">" : " ",
-                    s.c_str(),
-                    nbr_games,
-                    nbr_games==1 ? "game" : "games",
-                    percentage_score,
-                    nbr_white_wins, nbr_black_wins, nbr_draws );
-            cprintf( "%s\n", buf );
-            wxString wstr(buf);
-            strings_stats.Add(wstr);
+            NextMoveStrings( cr_to_match, next_moves, user_move, add_go_back, go_back_string, moves_in_this_position, strings_stats );
         }
 
-        // Print the transpositions in order
-        std::sort( transpositions.rbegin(), transpositions.rend() );
-        cprintf( "%d transpositions\n", transpositions.size() );
+        // Transpositions are only known once all the games are found
         wxArrayString strings_transpos;
-        for( unsigned int j=0; j<transpositions.size(); j++ )
-        {
-            PATH_TO_POSITION *p = &transpositions[j];
-            size_t len = p->blob.length();
-            CompressMoves press;
-            std::vector<thc::Move> unpacked = press.Uncompress(p->blob);
-            std::string txt;
-            thc::ChessRules cr2;
-            for( unsigned int k=0; k<len; k++ )
-            {
-                thc::Move mv = unpacked[k];
-                if( cr2.white )
-                {
-                    char buf[100];
-                    sprintf( buf, "%d.", cr2.full_move_count );
-                    txt += buf;
-                }
-                std::string s = mv.NaturalOut(&cr2);
-                LangOut(s);
-                txt += s;
-                txt += " ";
-                cr2.PlayMove(mv);
-            }
-            char buf[2000];
-            sprintf( buf, "T%d: %s: %d occurences", j+1, txt.c_str(), p->frequency );
-            cprintf( "%s\n", buf );
-            wxString wstr(buf);
-            strings_transpos.Add(wstr);
-        }
+        if( streaming )
+            strings_transpos.Add( "(Transpositions are listed once all the games are found, scroll to the end of the games)" );
+        else
+            TranspositionStrings( position_stats.transpositions, strings_transpos );
 
-        char buf[1000];
-        int total_games  = temp.gds.size();
-        int total_draws_plus_no_result = total_games - total_white_wins - total_black_wins;
-        double percent_score=0.0;
-        if( total_games )
-            percent_score= ((1.0*total_white_wins + 0.5*total_draws_plus_no_result) * 100.0) / total_games;
-        sprintf( buf, "%s%d %s, white scores %.1f%% +%d -%d =%d",
-                objs.gl->db_clipboard ? "Clipboard search: " : "",
-                total_games,
-                total_games==1 ? "game" : "games",
-                percent_score,
-                total_white_wins, total_black_wins, total_draws );
-        cprintf( "Got here #5, %s\n", buf );
-        title_ctrl->SetLabel( buf );
+        std::string totals = TotalsString( total_games, total_white_wins, total_black_wins, total_draws );
+        cprintf( "Got here #5, %s\n", totals.c_str() );
+        title_ctrl->SetLabel( totals.c_str() );
         if( !list_ctrl_stats )
         {
             //wxSize sz4 = mini_board->GetSize();
@@ -940,9 +1041,46 @@ void DbDialog::StatsCalculate()
     SetTitle(save_title);
 }
 
+// Find more games for the position while the list is scrolled, until there are at least
+//  nbr_wanted or all the games are found
+void DbDialog::StreamMoreGames( int nbr_wanted )
+{
+    stream_pending = false;
+    if( !streaming )
+        return;
+    MemoryPositionSearch *mps = &objs.db->tiny_db;
+    mps->DoSearchContinue( nbr_wanted );
+    std::vector< smart_ptr<ListableGame> >  &db_games    = mps->GetVectorSourceGames();
+    std::vector<DoSearchFoundGame>          &found_games = mps->GetVectorGamesFound();
+    for( size_t i=gc_db_displayed_games->gds.size(); i<found_games.size(); i++ )
+        gc_db_displayed_games->gds.push_back( db_games[found_games[i].idx] );
+    nbr_games_in_list_ctrl = gc_db_displayed_games->gds.size();
+    list_ctrl->SetItemCount(nbr_games_in_list_ctrl);
+    GdvEnableControlsIfGamesFound( nbr_games_in_list_ctrl>0 );
+
+    // All found, now the stats and transpositions are known
+    if( mps->IsSearchComplete() )
+    {
+        streaming = false;
+        position_stats = mps->GetPositionStats();
+        std::string totals = TotalsString( nbr_games_in_list_ctrl, position_stats.total_white_wins,
+                                           position_stats.total_black_wins, position_stats.total_draws );
+        title_ctrl->SetLabel( totals.c_str() );
+        wxArrayString strings_transpos;
+        TranspositionStrings( position_stats.transpositions, strings_transpos );
+        if( list_ctrl_transpo )
+        {
+            list_ctrl_transpo->Clear();
+            if( !strings_transpos.IsEmpty() )
+                list_ctrl_transpo->InsertItems( strings_transpos, 0 );
+        }
+    }
+}
+
 // Search for patterns
 void DbDialog::PatternSearch()
 {
+    streaming = false;
     gc_db_displayed_games->gds.clear();
     cprintf( "Remove focus %d\n", track->focus_idx );
     list_ctrl->SetItemState( track->focus_idx, 0, wxLIST_STATE_FOCUSED );
@@ -963,15 +1101,18 @@ void DbDialog::PatternSearch()
     {
         std::vector< smart_ptr<ListableGame> > *clipboard_source = &objs.gl->gc_clipboard.gds;
 
-        // The promotion attribute is only set automatically for the tiny database games (at the moment)
+        // The promotion attribute is kept once calculated (edited games recalculate it
+        //  along with their compressed moves if they've changed)
         for( size_t i=0; i<clipboard_source->size(); i++ )
-            (*clipboard_source)[i]->CalculatePromotionAttribute();
+            (*clipboard_source)[i]->EnsurePromotionAttribute();
         ProgressBar progress2(objs.gl->db_clipboard ? "Searching" : "Searching", "Searching",false);
+        mps->SetFilter( SearchFilter() );
         game_count = mps->DoPatternSearch(pm,&progress2,stats_,clipboard_source);
     }
     else
     {
         mps = &objs.db->tiny_db;
+        mps->SetFilter( SearchFilter() );
         ProgressBar progress2("Searching", "Searching",false);
         game_count = mps->DoPatternSearch(pm,&progress2,stats_);
     }
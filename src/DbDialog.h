@@ -23,32 +23,13 @@
 #include "GamesDialog.h"
 
 
-// Each move in a given position has stats associated with it
-struct MOVE_STATS
-{
-    int nbr_games;
-    int nbr_white_wins;
-    int nbr_black_wins;
-    int nbr_draws;
-
-    // Sort according to number of games
-    bool operator < (const MOVE_STATS& ms)  const { return nbr_games < ms.nbr_games; }
-    bool operator > (const MOVE_STATS& ms)  const { return nbr_games > ms.nbr_games; }
-    bool operator == (const MOVE_STATS& ms) const { return nbr_games == ms.nbr_games; }
-};
+// Only the most frequent transpositions are listed
+#define DB_TRANSPOSITIONS_SHOWN 100
 
-// Individual path to a given position
-struct PATH_TO_POSITION
-{
-    PATH_TO_POSITION() { frequency=0; }
-    int frequency;
-    std::string blob;
-
-    // Sort according to frequency
-    bool operator < (const PATH_TO_POSITION& ptp)  const { return frequency < ptp.frequency; }
-    bool operator > (const PATH_TO_POSITION& ptp)  const { return frequency > ptp.frequency; }
-    bool operator == (const PATH_TO_POSITION& ptp) const { return frequency == ptp.frequency; }
-};
+// Position searches with the Next Move list from the opening tree find games a screenful
+//  or so at a time, more once the list is scrolled to within DB_STREAM_PREFETCH of the end
+#define DB_STREAM_FIRST     100
+#define DB_STREAM_PREFETCH  50
 
 // DbDialog class declaration
 class DbDialog : public GamesDialog
@@ -68,8 +49,8 @@ public:
     );
     virtual ~DbDialog() {}
 
-    // We calculate a vector of all blobs in the games that leading to the search position
-    std::vector< PATH_TO_POSITION > transpositions;
+    // Results, next moves and all the paths (blobs) in the games leading to the search position
+    PositionStats position_stats;
     bool ReadGameFromSearchResults( int item, CompactGame &info );
     void MoveColCompare();
 
@@ -84,6 +65,7 @@ public:
     virtual void GdvHelpClick();
     virtual void GdvCheckBox( bool checked );
     virtual void GdvCheckBox2( bool checked );
+    virtual void GdvUtility();
     virtual void GdvSearch();
     virtual void GdvButton1();
     virtual void GdvButton2();
@@ -98,6 +80,7 @@ public:
     // Helpers
     void CopyOrAdd( bool clear_clipboard );
     void StatsCalculate();
+    void StreamMoreGames( int nbr_wanted );
     void PatternSearch();
 
     // Sets the help text for the dialog controls
@@ -105,8 +88,9 @@ public:
 
     // Data members
 private:
-    std::map< char, MOVE_STATS > stats; // map each compressed move in the position to move stats
     bool white_player_search;
+    bool streaming;         // position search not complete, see StreamMoreGames()
+    bool stream_pending;
     std::vector<thc::Move> moves_in_this_position;
     std::vector<thc::Move> moves_from_base_position;
     GamesCache *gc_db_displayed_games;
@@ -5,12 +5,14 @@
  *  Copyright 2010-2014, Bill Forster <billforsternz at gmail dot com>
  ****************************************************************************/
 #include <stdio.h>
+#include <stdlib.h>
 #include <map>
 #include "thc.h"
 #include "DebugPrintf.h"
 #include "BinDb.h"
 #include "PgnRead.h"
 #include "CompressMoves.h"
+#include "BitboardPosition.h"
 #include "DbPrimitives.h"
 #include "DbMaintenance.h"
 
@@ -38,6 +40,9 @@ static void players_database( const char *event, const char *site, const char *d
                        const char *white, const char *black, const char *result, const char *white_elo, const char *black_elo, const char *eco,
                        int nbr_moves, thc::Move *moves, uint64_t *hashes );
 
+// Single threaded with diagnostics, for checking the compression itself. To check
+//  big files for illegal or truncated games use the tarrasch-validate command line
+//  program instead
 void db_maintenance_verify_compression()
 {
     ifile = fopen( PGN_FILE, "rt" );
@@ -64,6 +69,45 @@ void db_maintenance_verify_compression()
         fclose(logfile);
 }
 
+// Time CompressMoves decoding over a corpus of compressed games. If there are no
+//  games to hand use (reproducible) random games instead
+void db_maintenance_decode_speed( const std::vector<std::string> &blobs )
+{
+    std::vector<std::string> corpus(blobs);
+    if( corpus.size() == 0 )
+    {
+        srand(1);
+        for( int i=0; i<10000; i++ )
+        {
+            thc::ChessRules cr;
+            std::vector<thc::Move> moves;
+            for( int j=0; j<120; j++ )
+            {
+                std::vector<thc::Move> list;
+                cr.GenLegalMoveList(list);
+                if( list.size() == 0 )
+                    break;
+                thc::Move mv = list[rand()%list.size()];
+                cr.PlayMove(mv);
+                moves.push_back(mv);
+            }
+            CompressMoves press;
+            corpus.push_back( press.Compress(moves) );
+        }
+    }
+    size_t total = 0;
+    for( const std::string &blob: corpus )
+        total += blob.length();
+    int passes = total>0 ? static_cast<int>(5000000/total) : 1;   // at least 5 million moves, roughly
+    if( passes < 1 )
+        passes = 1;
+    cprintf( "Decode speed test, %u games, %u moves, %d passes\n", (unsigned)corpus.size(), (unsigned)total, passes );
+    CompressMovesDecodeBenchmark( corpus, passes );
+
+    // Slow mode decoding relies on the bitboard move generator, check and time it
+    BitboardPerftBenchmark();
+}
+
 void db_maintenance_create_player_database()
 {
     //std::string input("C:\\Users\\Bill\\Documents\\T3Database\\millionbase-2.22");
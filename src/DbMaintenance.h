@@ -6,8 +6,11 @@
  ****************************************************************************/
 #ifndef DB_MAINTENANCE_H
 #define DB_MAINTENANCE_H
+#include <string>
+#include <vector>
 
 void db_maintenance_create_player_database();
 void db_maintenance_verify_compression();
+void db_maintenance_decode_speed( const std::vector<std::string> &blobs );
 
 #endif // DB_MAINTENANCE_H
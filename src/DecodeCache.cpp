@@ -0,0 +1,122 @@
+/****************************************************************************
+ * Decode once cache of recently used games, the moves decoded from each
+ *  game's compressed moves plus sparse position snapshots
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include "CompressMoves.h"
+#include "DecodeCache.h"
+#include "SlimPosition.h"
+
+DecodeCache gbl_decode_cache;
+
+DecodeCache::DecodeCache( size_t capacity, int interval )
+{
+    this->capacity = capacity>0 ? capacity : 1;
+    this->interval = interval>0 ? interval : 1;
+}
+
+// Find a game and make it the most recently used
+DecodeCache::Entry *DecodeCache::Find( uint32_t game_id )
+{
+    auto it = index.find(game_id);
+    if( it == index.end() )
+        return NULL;
+    lru.splice( lru.begin(), lru, it->second );
+    return &lru.front();
+}
+
+void DecodeCache::Trim()
+{
+    while( lru.size() > capacity )
+    {
+        index.erase( lru.back().game_id );
+        lru.pop_back();
+    }
+}
+
+void DecodeCache::Uncompress( uint32_t game_id, const thc::ChessPosition &start, const std::string &blob, std::vector<thc::Move> &moves )
+{
+    if( game_id != 0 )
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        Entry *e = Find(game_id);
+        if( e && e->blob==blob && e->start==start )
+        {
+            moves = e->moves;
+            return;
+        }
+    }
+
+    // Decode outside the lock
+    thc::ChessPosition cp = start;
+    CompressMoves press(cp);
+    std::string blob_copy = blob;
+    moves = press.Uncompress(blob_copy);
+    if( game_id == 0 )
+        return;
+    std::lock_guard<std::mutex> lock(mtx);
+    Entry *e = Find(game_id);
+    if( !e )
+    {
+        lru.push_front( Entry() );
+        e = &lru.front();
+        e->game_id = game_id;
+        index[game_id] = lru.begin();
+    }
+    e->start = start;
+    e->blob  = blob;
+    e->moves = moves;
+    e->snapshots.clear();   // built when first needed
+    Trim();
+}
+
+bool DecodeCache::Blob( uint32_t game_id, const std::vector<thc::Move> &moves, std::string &blob )
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    Entry *e = game_id ? Find(game_id) : NULL;
+    if( !e || e->moves!=moves )
+        return false;
+    blob = e->blob;
+    return true;
+}
+
+int DecodeCache::Snapshot( uint32_t game_id, const std::vector<thc::Move> &moves, int ply, thc::ChessPosition &cp )
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    Entry *e = game_id ? Find(game_id) : NULL;
+    if( !e || !(e->start==cp) || e->moves!=moves )
+        return 0;
+    int nbr_moves = static_cast<int>(e->moves.size());
+    if( e->snapshots.size() == 0 )
+    {
+        SlimPosition cr( e->start );
+        e->snapshots.reserve( nbr_moves/interval + 1 );
+        for( int i=0; i<=nbr_moves; i++ )
+        {
+            if( i%interval == 0 )
+            {
+                thc::ChessPosition snapshot;
+                cr.Get( snapshot );
+                e->snapshots.push_back( snapshot );
+            }
+            if( i < nbr_moves )
+                cr.PlayMove( e->moves[i] );
+        }
+    }
+    if( ply > nbr_moves )
+        ply = nbr_moves;
+    if( ply < 0 )
+        ply = 0;
+    int k = ply/interval;
+    cp = e->snapshots[k];
+    return k*interval;
+}
+
+void DecodeCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    lru.clear();
+    index.clear();
+}
@@ -0,0 +1,60 @@
+/****************************************************************************
+ * Decode once cache of recently used games, the moves decoded from each
+ *  game's compressed moves plus sparse position snapshots
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef DECODE_CACHE_H
+#define DECODE_CACHE_H
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include "thc.h"
+
+#define DECODE_CACHE_GAMES      1024    // least recently used games are dropped beyond this
+#define DECODE_CACHE_INTERVAL   16      // plies between position snapshots
+
+class DecodeCache
+{
+public:
+    DecodeCache( size_t capacity=DECODE_CACHE_GAMES, int interval=DECODE_CACHE_INTERVAL );
+
+    // Same as CompressMoves(start).Uncompress(blob), but only the first time a game is
+    //  seen. Game id 0 means no id, always decoded
+    void Uncompress( uint32_t game_id, const thc::ChessPosition &start, const std::string &blob, std::vector<thc::Move> &moves );
+
+    // Compressed moves of a cached game, provided it was decoded to exactly these moves
+    bool Blob( uint32_t game_id, const std::vector<thc::Move> &moves, std::string &blob );
+
+    // Nearest snapshot at or before ply. On entry cp is the game's start position, if the
+    //  game is cached with the same start position and moves, cp is changed to the position
+    //  after the returned number of plies, otherwise 0 is returned and cp is unchanged
+    int Snapshot( uint32_t game_id, const std::vector<thc::Move> &moves, int ply, thc::ChessPosition &cp );
+
+    void Clear();
+
+private:
+    struct Entry
+    {
+        uint32_t                        game_id;
+        thc::ChessPosition              start;
+        std::string                     blob;
+        std::vector<thc::Move>          moves;
+        std::vector<thc::ChessPosition> snapshots;  // snapshots[k] is position after k*interval plies
+    };
+    Entry *Find( uint32_t game_id );
+    void Trim();
+    size_t              capacity;
+    int                 interval;
+    std::list<Entry>    lru;        // most recently used first
+    std::unordered_map< uint32_t, std::list<Entry>::iterator > index;
+    std::mutex          mtx;
+};
+
+extern DecodeCache gbl_decode_cache;
+
+#endif // DECODE_CACHE_H
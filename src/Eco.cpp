@@ -11,6 +11,7 @@
 #include "GameDocument.h"
 #include "DebugPrintf.h"
 #include "CompressMoves.h"
+#include "DecodeCache.h"
 
 struct ECO_CODE
 {
@@ -666,10 +667,43 @@ static void eco_codes_inner()
     }
 }
 
+// Hash the opening plies in one pass over the compressed moves, then only play
+//  through as far as the last ply with a hash match to check the positions
 const char *eco_calculate( std::string &compressed_moves )
 {
+    eco_begin();
+    size_t len = compressed_moves.length()<30 ? compressed_moves.length() : 30;
     CompressMoves press;
-    std::vector<thc::Move> v = press.Uncompress(compressed_moves);
+    std::vector<uint64_t> hashes;
+    press.Hash64Batch( compressed_moves.c_str(), len, hashes );
+    std::vector<int> candidates( hashes.size(), -1 );
+    size_t last=0;
+    for( size_t i=1; i<hashes.size(); i++ )
+    {
+        std::map<uint64_t,int>::iterator it = lookup.find(hashes[i]);
+        if( it != lookup.end() )
+        {
+            candidates[i] = it->second;
+            last = i;
+        }
+    }
+    int best_so_far=0;
+    CompressMoves check;
+    for( size_t i=1; i<=last; i++ )
+    {
+        check.UncompressMove( compressed_moves[i-1] );
+        int found = candidates[i];
+        if( found>=0 && eco_codes[found].compressed_moves.length() >= eco_codes[best_so_far].compressed_moves.length() && eco_codes[found].position==check.cr )
+            best_so_far = found;
+    }
+    return eco_codes[best_so_far].eco_code;
+}
+
+const char *eco_calculate( uint32_t game_id, const std::string &compressed_moves )
+{
+    thc::ChessPosition start;
+    std::vector<thc::Move> v;
+    gbl_decode_cache.Uncompress( game_id, start, compressed_moves, v );
     return eco_calculate( v );
 }
 
@@ -6,6 +6,8 @@
  ****************************************************************************/
 #ifndef ECO_H
 #define ECO_H
+#include <stdint.h>
+#include <string>
 #include <vector>
 #include "thc.h"
 
@@ -13,5 +15,6 @@ const char *eco_ref( const char *eco_in );  // get reference compressed moves fo
 const char *eco_calculate( const std::vector<thc::Move> &moves );
 #define konst   // should be const, Idea: use konst to indicate things to migrate to const
 const char *eco_calculate( konst std::string &compressed_moves );
+const char *eco_calculate( uint32_t game_id, const std::string &compressed_moves );    // decoded once per game
 
 #endif // ECO_H
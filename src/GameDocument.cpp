@@ -13,6 +13,9 @@
 #include "GameLogic.h"
 #include "Lang.h"
 #include "GameDocument.h"
+#include "BitboardPosition.h"
+#include "PgnTokenizer.h"
+#include "PgnStreamWriter.h"
 
 GameDocument::GameDocument( GameLogic *gl )
     : gv(gl)
@@ -256,28 +259,14 @@ std::string GameDocument::Description()
 bool GameDocument::PgnParse( bool use_semi, int &nbr_converted, const std::string str, thc::ChessRules &cr, VARIATION *pvar, bool use_current_language, int imove )
 {
 
-    // Main state machine has these states
-    enum PSTATE
-    {
-        BETWEEN_MOVES,
-        IN_COMMENT,
-        IN_DOLLAR,
-        IN_NUMBER,
-        IN_MISC,
-        IN_STAR,
-        IN_MOVE
-    };
-
-    // Key state variables
+    // The text is split into tokens by PgnTokenizer, key state variables are
  // VARIATION   *pvar;          // the current variation, within this->tree
  // thc::ChessRules   cr;            // the current chess position
-    PSTATE       state;         // the current state machine state
 
     // Allow stacking of the key state variables
     const int MAX_DEPTH=20;
     struct STACK_ELEMENT
     {
-        PSTATE     state;
         VARIATION  *pvar;
         thc::ChessRules cr;
 
@@ -294,15 +283,7 @@ bool GameDocument::PgnParse( bool use_semi, int &nbr_converted, const std::strin
 
     // Misc
     #define Error(x)
-    std::string move_str;
-    std::string comment_str;
     std::string buffered_comment;
-    std::string prefix;
-    char comment_ch='\0', previous_ch='\0';
-    int nag_value=0;
-    PSTATE old_state, save_state=BETWEEN_MOVES;
-    char ch, push_back='\0';
-    unsigned int str_idx=0;
     bool was_empty = false;
     nbr_converted = 0;
     MoveTree *add_error_comment_here = NULL;
@@ -324,7 +305,6 @@ bool GameDocument::PgnParse( bool use_semi, int &nbr_converted, const std::strin
         stk->v      = tree.variations.begin();
         stk->vend   = tree.variations.end();
         stk->cr_variation_start = *tree.root;
-        stk->state  = BETWEEN_MOVES;
         stk->m      = stk->v->begin();
         stk->mend   = stk->v->end();
         stk->cr     = stk->cr_variation_start;
@@ -365,7 +345,6 @@ bool GameDocument::PgnParse( bool use_semi, int &nbr_converted, const std::strin
                     stk->vend   = m->variations.end();
                     stk->m      = stk->v->begin();
                     stk->mend   = stk->v->end();
-                    stk->state  = BETWEEN_MOVES;
                     stk->cr     = stk_array[stk_idx-1].cr;
                     stk->cr.PopMove( m->game_move.move );
                     stk->cr_variation_start = stk->cr;
@@ -408,426 +387,286 @@ bool GameDocument::PgnParse( bool use_semi, int &nbr_converted, const std::strin
             cr = stk->cr;
         }
     }
-    state = BETWEEN_MOVES;      // state machine
-    old_state = BETWEEN_MOVES;
-
     // Start loop
     bool okay=true;
     bool eof=false;
-    ch = ' ';   // dummy to start loop
-    while( okay && !eof )
+    size_t prefix_start=0;      // on error, the text from here on becomes a comment
+    PgnTokenizer tz( str.c_str(), str.length(), use_semi );
+    PgnToken tok;
+    while( okay && !eof && tz.Next(tok) )
     {
-        push_back = '\0';
-        old_state = state;
-        if( ch == '\x96' )  // ANSI code for en dash, sometimes used instead of '-'
-            ch = '-';
-        bool in_number = isascii(ch) && isdigit(ch);
-        bool in_move   = isascii(ch) && isalnum(ch);
-        bool in_misc   = (ch=='.'||ch=='?'||ch=='!'||ch=='+'||ch=='-'||ch=='='||ch=='/');
-        bool in_star   = (ch=='*');
-        switch( state )
+        bool was_in_move = false;
+        bool do_nothing_move = false;
+        switch( tok.type )
         {
-
-            // In a comment
-            case IN_COMMENT:
+            // Move numbers, stray characters etc.
+            default:
             {
+                break;
+            }
 
-                // End of the comment ?
-                if(  (comment_ch=='{' && ch=='}') ||
-                     (comment_ch==';' && ch!=';' && ch!='\n' && ch!='\r' && (previous_ch=='\n'||previous_ch=='\r') )
-                  )
+            // A comment
+            case PGN_TOKEN_COMMENT:
+            {
+                std::string comment_str;
+                for( int i=0; i<tok.len; i++ )
                 {
-                    if( comment_ch == ';' )
-                        push_back = ch;
-                    else
-                    {
-                        // New policy from V2.03c
-                        //  Only create '{' comments (most chess software doesn't understand ';' comments)
-                        //  If  "}" appears in comment transform to "|>"    (change *is* restored when reading .pgn)
-                        //  If  "|>" appears in comment transform to "| >"  (change is *not* restored when reading .pgn)
-                        std::string ReplaceAll( const std::string &in, const std::string &from, const std::string &to );
-                        comment_str = ReplaceAll( comment_str, "|>", "}" );
-                    }
-                    if( (*pvar).size() == 0 )
-                    {
-                        if( 0 == buffered_comment.length() )
-                            buffered_comment = comment_str;
-                        else
-                        {
-                            buffered_comment += " ";
-                            buffered_comment += comment_str;
-                        }
-                    }
-                    else
-                    {
-                        MoveTree *plast_move = &(*pvar)[(*pvar).size()-1];
-                        if( 0 == plast_move->game_move.comment.length() )
-                            plast_move->game_move.comment = comment_str;
-                        else
-                        {
-                            plast_move->game_move.comment += " ";
-                            plast_move->game_move.comment += comment_str;
-                        }
-                    }
-                    state = save_state;
+                    char c = tok.txt[i];
+                    if( c == '\n' )
+                        comment_str += ' ';
+                    else if( c != '\r' )
+                        comment_str += c;
                 }
-
-                // Else continue comment
+                if( tok.comment_ch == ';' )
+                    comment_str += ' ';     // for the line end
                 else
                 {
-                    bool skip = (comment_ch==';' && ch==';' && (previous_ch=='\n'||previous_ch=='\r') );
-                    if( !skip )
+                    // New policy from V2.03c
+                    //  Only create '{' comments (most chess software doesn't understand ';' comments)
+                    //  If  "}" appears in comment transform to "|>"    (change *is* restored when reading .pgn)
+                    //  If  "|>" appears in comment transform to "| >"  (change is *not* restored when reading .pgn)
+                    std::string ReplaceAll( const std::string &in, const std::string &from, const std::string &to );
+                    comment_str = ReplaceAll( comment_str, "|>", "}" );
+                }
+                if( (*pvar).size() == 0 )
+                {
+                    if( 0 == buffered_comment.length() )
+                        buffered_comment = comment_str;
+                    else
                     {
-                        if( ch == '\n' )
-                            comment_str += ' ';
-                        else if( ch != '\r' )
-                            comment_str += (char)ch;
+                        buffered_comment += " ";
+                        buffered_comment += comment_str;
                     }
                 }
-                break;
-            }
-
-            // Creating NAG value
-            case IN_DOLLAR:
-            {
-                if( isascii(ch) && isdigit(ch) )
-                    nag_value = nag_value*10+(ch-'0');
                 else
                 {
-                    /*
-                    const char *nag_array[] =
-                    {
-                        "",
-                        " !",     // $1
-                        " ?",     // $2
-                        " !!",    // $3
-                        " ??",    // $4
-                        " !?",    // $5
-                        " ?!",    // $6
-                        "",       // $7
-                        "",       // $8
-                        " ??",    // $9
-                        " =",     // $10
-                        " =",     // $11
-                        " =",     // $12
-                        "",       // $13
-                        " +=",    // $14
-                        " =+",    // $15
-                        " +/-",   // $16
-                        " -/+",   // $17
-                        " +-",    // $18
-                        " -+",    // $19
-                        " +-",    // $20
-                        " -+"     // $21
-                    };  */
-                    if( 1<=nag_value && nag_value<=9 && (*pvar).size() != 0 )
-                    {
-                        MoveTree *plast_move = &(*pvar)[(*pvar).size()-1];
-                        plast_move->game_move.nag_value1 = nag_value;
-                    }
-                    else if( 10<=nag_value && nag_value<=21 && (*pvar).size() != 0 )
+                    MoveTree *plast_move = &(*pvar)[(*pvar).size()-1];
+                    if( 0 == plast_move->game_move.comment.length() )
+                        plast_move->game_move.comment = comment_str;
+                    else
                     {
-                        MoveTree *plast_move = &(*pvar)[(*pvar).size()-1];
-                        plast_move->game_move.nag_value2 = nag_value;
+                        plast_move->game_move.comment += " ";
+                        plast_move->game_move.comment += comment_str;
                     }
-                    push_back = ch;
-                    state = save_state;
                 }
                 break;
             }
 
-            // Waiting for something to happen
-            case BETWEEN_MOVES:
+            // A NAG
+            case PGN_TOKEN_NAG:
             {
-
-                // NAG token ?
-                if( ch == '$' )
+                int nag_value = tok.value;
+                if( 1<=nag_value && nag_value<=9 && (*pvar).size() != 0 )
                 {
-                    save_state = state;
-                    state = IN_DOLLAR;
-                    nag_value = 0;
+                    MoveTree *plast_move = &(*pvar)[(*pvar).size()-1];
+                    plast_move->game_move.nag_value1 = nag_value;
                 }
-
-                // Start {comment} style comment ?
-                else if( ch == '{' )
+                else if( 10<=nag_value && nag_value<=21 && (*pvar).size() != 0 )
                 {
-                    save_state = state;
-                    comment_ch = '{';
-                    state = IN_COMMENT;
-                    comment_str = "";
+                    MoveTree *plast_move = &(*pvar)[(*pvar).size()-1];
+                    plast_move->game_move.nag_value2 = nag_value;
                 }
+                break;
+            }
 
-                // Start ;comment style comment ?
-                else if( use_semi && ch == ';' )
+            // Start new variation
+            case PGN_TOKEN_VARIATION_START:
+            {
+
+                // Push current state onto a stack
+                stk->pvar  = pvar;
+                stk->cr    = cr;
+                if( stk_idx+1 >= MAX_DEPTH )
                 {
-                    save_state = state;
-                    comment_ch = ';';
-                    state = IN_COMMENT;
-                    comment_str = "";
+                    Error("Too deep");
+                    okay = false;
                 }
-
-                // Start new variation ?
-                else if( ch == '(' )
+                else
                 {
-
-                    // Push current state onto a stack
-                    stk->pvar  = pvar;
-                    stk->cr    = cr;
-                    stk->state = state;
-                    if( stk_idx+1 >= MAX_DEPTH )
+                    stk_idx++;
+                    stk = &stk_array[stk_idx];
+                    imove = (imove==-1 ? (*pvar).size()-1 : imove);
+                    if( imove < 0 )
                     {
-                        Error("Too deep");
+                        Error("Cannot branch from empty variation");
                         okay = false;
                     }
-                    else
+                    if( okay )
                     {
-                        stk_idx++;
-                        stk = &stk_array[stk_idx];
-                        imove = (imove==-1 ? (*pvar).size()-1 : imove);
-                        if( imove < 0 )
-                        {
-                            Error("Cannot branch from empty variation");
-                            okay = false;
-                        }
-                        if( okay )
-                        {
-                            MoveTree *pnode = &(*pvar)[imove];
-                            imove = -1;
+                        MoveTree *pnode = &(*pvar)[imove];
+                        imove = -1;
 
-                            // Undo the last move to start the new branch
-                            cr.PopMove( (*pnode).game_move.move );
+                        // Undo the last move to start the new branch
+                        cr.PopMove( (*pnode).game_move.move );
 
-                            // Start a new, currently empty, variation
-                            VARIATION variation;
-                            variation.clear();
-                            (*pnode).variations.push_back(variation);
+                        // Start a new, currently empty, variation
+                        VARIATION variation;
+                        variation.clear();
+                        (*pnode).variations.push_back(variation);
 
-                            // Set that as the current variation
-                            int vlen = (*pnode).variations.size();
-                            pvar = &(*pnode).variations[vlen-1];
-                        }
+                        // Set that as the current variation
+                        int vlen = (*pnode).variations.size();
+                        pvar = &(*pnode).variations[vlen-1];
                     }
                 }
+                break;
+            }
 
-                // End variation ?
-                else if( ch == ')' )
-                {
-                    imove = -1;     // end start in middle feature
+            // End variation
+            case PGN_TOKEN_VARIATION_END:
+            {
+                imove = -1;     // end start in middle feature
 
-                    // Pop old state off stack
-                    if( stk_idx == 0 )
-                    {
-                        Error("Mismatched )");
-                        okay = false;
-                    }
-                    else
-                    {
-                        stk_idx--;
-                        stk   = &stk_array[stk_idx];
-                        cr    = stk->cr;
-                        state = stk->state;
-                        VARIATION  *pvar_just_added = pvar;
-                        pvar  = stk->pvar;
-
-                        // If variation we added was empty, remove it
-                        int idx = (*pvar).size()-1;
-                        if( idx >= 0 )
-                        {
-                            MoveTree *pnode = &(*pvar)[idx];
-                            int vlen = (*pnode).variations.size();
-                            if( vlen > 1 )
-                            {
-                                VARIATION *pvar_end = &(*pnode).variations[vlen-1];
-                                if( pvar_just_added==pvar_end && (*pvar_just_added).size()==0 )
-                                    (*pnode).variations.pop_back();
-                            }
-                        }
-                    }
+                // Pop old state off stack
+                if( stk_idx == 0 )
+                {
+                    Error("Mismatched )");
+                    okay = false;
                 }
-
-                // Else go into token if possible
                 else
                 {
-                    if( in_number || in_misc || in_star || in_move )
+                    stk_idx--;
+                    stk   = &stk_array[stk_idx];
+                    cr    = stk->cr;
+                    VARIATION  *pvar_just_added = pvar;
+                    pvar  = stk->pvar;
+
+                    // If variation we added was empty, remove it
+                    int idx = (*pvar).size()-1;
+                    if( idx >= 0 )
                     {
-                        move_str = "";
-                        push_back = ch;
-                        if( in_number )
-                            state = IN_NUMBER;
-                        else if( in_move )
-                            state = IN_MOVE;
-                        else if( in_misc )
-                            state = IN_MISC;
-                        else if( in_star )
-                            state = IN_STAR;
+                        MoveTree *pnode = &(*pvar)[idx];
+                        int vlen = (*pnode).variations.size();
+                        if( vlen > 1 )
+                        {
+                            VARIATION *pvar_end = &(*pnode).variations[vlen-1];
+                            if( pvar_just_added==pvar_end && (*pvar_just_added).size()==0 )
+                                (*pnode).variations.pop_back();
+                        }
                     }
                 }
                 break;
             }
 
-            // Collect a token
-            case IN_NUMBER:
-            case IN_MISC:
-            case IN_STAR:
-            case IN_MOVE:
+            // Result
+            case PGN_TOKEN_RESULT:
             {
-                bool keep_buffering=false;
-                if( state == IN_NUMBER )
-                    keep_buffering = in_number || ch=='-' || ch=='/';   // eg 0-1 or 1/2-1/2
-                else if( state == IN_MISC )
-                    keep_buffering = in_misc;
-                else if( state == IN_STAR )
-                    keep_buffering = in_star;
-                else if( state == IN_MOVE )
+                eof = true;     // just stop (a bit simplistic)
+                break;
+            }
+
+            // Punctuation
+            case PGN_TOKEN_GLYPH:
+            {
+                if( 0 == strcmp(tok.txt,"--") )     // do nothing or pass move
                 {
-                    if( ch=='=' || ch=='+' || ch=='#' || ch=='-' )  // can also be in moves
-                        keep_buffering = true;
-                    else
-                        keep_buffering = in_move;
+                    do_nothing_move = true;
+                    was_in_move = true;
+                    break;
                 }
-                if( keep_buffering )
-                    move_str += (char)ch;
-                else
+
+                // Support '?', '!!' etc as text rather than only as NAG codes
+                int nag_value2 = NagAlternative(tok.txt);
+                if( 1<=nag_value2 && nag_value2<=9 && (*pvar).size() != 0 )
                 {
-                    push_back = ch;
-                    bool was_in_move = (state==IN_MOVE);
-                    bool do_nothing_move = false;
+                    MoveTree *plast_move = &(*pvar)[ imove==-1 ? (*pvar).size()-1 : imove ];
+                    plast_move->game_move.nag_value1 = nag_value2;
+                    prefix_start = tok.end;
+                    nbr_converted++;    // so just a lone ! for example counts
+                }
+                else if( 10<=nag_value2 && nag_value2<=21 && (*pvar).size() != 0 )
+                {
+                    MoveTree *plast_move = &(*pvar)[ imove==-1 ? (*pvar).size()-1 : imove ];
+                    plast_move->game_move.nag_value2 = nag_value2;
+                    prefix_start = tok.end;
+                    nbr_converted++;    // so just a lone += for example counts
+                }
+                break;
+            }
 
-                    // Support some popular variants
-                    if( state == IN_NUMBER )
-                    {
-                        if( move_str == "0-0" )
-                        {
-                            move_str = "O-O";
-                            was_in_move = true;
-                        }
-                        else if( move_str=="0-0-0" )
-                        {
-                            move_str = "O-O-O";
-                            was_in_move = true;
-                        }
-                    }
-                    else if( state == IN_MISC )
-                    {
-                        if( move_str == "--" )     // do nothing or pass move
-                        {
-                            do_nothing_move = true;
-                            was_in_move = true;
-                        }
+            // Move
+            case PGN_TOKEN_SAN:
+            {
+                was_in_move = true;
+                break;
+            }
+        }
+        if( was_in_move )
+        {
+            bool adding_from_middle_to_end_bug = false;
+            int sz = (*pvar).size();
+            if( imove!=-1 && imove!=sz-1 )
+                adding_from_middle_to_end_bug = true;
+            if( adding_from_middle_to_end_bug )
+                okay = false;
+            else
+            {
+                imove = -1;     // end start in middle feature
 
-                        // Support '?', '!!' etc as text rather than only as NAG codes
-                        int nag_value2 = NagAlternative(move_str.c_str());
-                        if( 1<=nag_value2 && nag_value2<=9 && (*pvar).size() != 0 )
-                        {
-                            MoveTree *plast_move = &(*pvar)[ imove==-1 ? (*pvar).size()-1 : imove ];
-                            plast_move->game_move.nag_value1 = nag_value2;
-                            prefix = "";
-                            nbr_converted++;    // so just a lone ! for example counts
-                        }
-                        else if( 10<=nag_value2 && nag_value2<=21 && (*pvar).size() != 0 )
-                        {
-                            MoveTree *plast_move = &(*pvar)[ imove==-1 ? (*pvar).size()-1 : imove ];
-                            plast_move->game_move.nag_value2 = nag_value2;
-                            prefix = "";
-                            nbr_converted++;    // so just a lone += for example counts
+                // Try to add move to current variation
+                MoveTree node;
+                std::string temp = tok.txt;
+                if( use_current_language )
+                    LangToEnglish(temp);
+                if( !do_nothing_move )
+                    okay = BitboardNaturalIn(node.game_move.move,&cr,temp.c_str());
+                else
+                {   // Nasty little hack - support "--" = do nothing, create a move from one empty square
+                    //  to same empty square, capturing empty - chess engine will "play" that okay
+                    okay = false;
+                    for( int i=63; i>=0; i-- )  // start search at h1 to avoiding a8a8 which is Invalid move
+                    {   // found an empty square yet ?
+                        if( cr.squares[i]==' ' || cr.squares[i]=='.' )  // plan to change empty from ' ' to '.', so be prepared
+                        {   // C++ can't cast into the bitfield, so do this, aaaaaaaargh
+                            static thc::Square lookup[] = { thc::a8,thc::b8,thc::c8,thc::d8,thc::e8,thc::f8,thc::g8,thc::h8,
+                                                            thc::a7,thc::b7,thc::c7,thc::d7,thc::e7,thc::f7,thc::g7,thc::h7,
+                                                            thc::a6,thc::b6,thc::c6,thc::d6,thc::e6,thc::f6,thc::g6,thc::h6,
+                                                            thc::a5,thc::b5,thc::c5,thc::d5,thc::e5,thc::f5,thc::g5,thc::h5,
+                                                            thc::a4,thc::b4,thc::c4,thc::d4,thc::e4,thc::f4,thc::g4,thc::h4,
+                                                            thc::a3,thc::b3,thc::c3,thc::d3,thc::e3,thc::f3,thc::g3,thc::h3,
+                                                            thc::a2,thc::b2,thc::c2,thc::d2,thc::e2,thc::f2,thc::g2,thc::h2,
+                                                            thc::a1,thc::b1,thc::c1,thc::d1,thc::e1,thc::f1,thc::g1,thc::h1
+                                                          };
+                            node.game_move.move.src =
+                            node.game_move.move.dst = lookup[i];
+                            node.game_move.move.capture = cr.squares[i];  // empty
+                            node.game_move.move.special = thc::NOT_SPECIAL;
+                            okay = true;
+                            break;
                         }
                     }
-                    state = BETWEEN_MOVES;
-                    if( PgnTestResult(move_str.c_str()) )
+                }
+                if( !okay )
+                {
+                    Error("Illegal move");
+                }
+                else
+                {
+                    prefix_start = tok.end;
+                    nbr_converted++;
+                    cr.PushMove(node.game_move.move);
+                    if( buffered_comment.length() )
                     {
-                        eof = true;     // just stop (a bit simplistic)
-                    }
-                    else if( was_in_move )
-                    {
-                        bool adding_from_middle_to_end_bug = false;
-                        int sz = (*pvar).size();
-                        if( imove!=-1 && imove!=sz-1 )
-                            adding_from_middle_to_end_bug = true;
-                        if( adding_from_middle_to_end_bug )
-                            okay = false;
-                        else
-                        {
-                            imove = -1;     // end start in middle feature
-
-                            // Try to add move to current variation
-                            MoveTree node;
-                            std::string temp = move_str;
-                            if( use_current_language )
-                                LangToEnglish(temp);
-                            if( !do_nothing_move )
-                                okay = node.game_move.move.NaturalIn(&cr,temp.c_str());
-                            else
-                            {   // Nasty little hack - support "--" = do nothing, create a move from one empty square
-                                //  to same empty square, capturing empty - chess engine will "play" that okay
-                                okay = false;
-                                for( int i=63; i>=0; i-- )  // start search at h1 to avoiding a8a8 which is Invalid move
-                                {   // found an empty square yet ?
-                                    if( cr.squares[i]==' ' || cr.squares[i]=='.' )  // plan to change empty from ' ' to '.', so be prepared
-                                    {   // C++ can't cast into the bitfield, so do this, aaaaaaaargh
-                                        static thc::Square lookup[] = { thc::a8,thc::b8,thc::c8,thc::d8,thc::e8,thc::f8,thc::g8,thc::h8,
-                                                                        thc::a7,thc::b7,thc::c7,thc::d7,thc::e7,thc::f7,thc::g7,thc::h7,
-                                                                        thc::a6,thc::b6,thc::c6,thc::d6,thc::e6,thc::f6,thc::g6,thc::h6,
-                                                                        thc::a5,thc::b5,thc::c5,thc::d5,thc::e5,thc::f5,thc::g5,thc::h5,
-                                                                        thc::a4,thc::b4,thc::c4,thc::d4,thc::e4,thc::f4,thc::g4,thc::h4,
-                                                                        thc::a3,thc::b3,thc::c3,thc::d3,thc::e3,thc::f3,thc::g3,thc::h3,
-                                                                        thc::a2,thc::b2,thc::c2,thc::d2,thc::e2,thc::f2,thc::g2,thc::h2,
-                                                                        thc::a1,thc::b1,thc::c1,thc::d1,thc::e1,thc::f1,thc::g1,thc::h1
-                                                                      };
-                                        node.game_move.move.src =
-                                        node.game_move.move.dst = lookup[i];
-                                        node.game_move.move.capture = cr.squares[i];  // empty
-                                        node.game_move.move.special = thc::NOT_SPECIAL;
-                                        okay = true;
-                                        break;
-                                    }
-                                }
-                            }
-                            if( !okay )
-                            {
-                                Error("Illegal move");
-                                //prefix += move_str;
-                                //prefix += push_back;
-                            }
-                            else
-                            {
-                                prefix = "";
-                                nbr_converted++;
-                                cr.PushMove(node.game_move.move);
-                                if( buffered_comment.length() )
-                                {
-                                    node.game_move.pre_comment = buffered_comment;
-                                    buffered_comment.clear();
-                                }
-                                node.game_move.nag_value1 = 0;
-                                node.game_move.nag_value2 = 0;
-                                (*pvar).push_back( node );
-                                add_error_comment_here = &(*pvar)[(*pvar).size()-1];
-                            }
-                        }
+                        node.game_move.pre_comment = buffered_comment;
+                        buffered_comment.clear();
                     }
+                    node.game_move.nag_value1 = 0;
+                    node.game_move.nag_value2 = 0;
+                    (*pvar).push_back( node );
+                    add_error_comment_here = &(*pvar)[(*pvar).size()-1];
                 }
-                break;
             }
         }
 
-        // State changes
-        if( state != old_state )
-        {
-            //fprintf( debug_log_file(), "State change %s->%s\n", ShowState(old_state), ShowState(state) );
-        }
-
         // Error handling, append the rest of the string as a comment
         if( !okay )
         {
-            std::string comment = prefix;
-            if( str_idx < str.length() )
-            {
-                std::string temp( str.begin()+str_idx, str.end() );
-                int len = temp.length();
-                if( len>0 && temp[len-1]==')' )
-                    temp = temp.substr(0,len-1);
-                comment += temp;
-            }
+            if( prefix_start>0 && prefix_start<str.length() && isascii(str[prefix_start]) && isspace(str[prefix_start]) )
+                prefix_start++;     // skip the separator after the last thing converted
+            std::string comment( str.begin()+prefix_start, str.end() );
+            int len = comment.length();
+            if( len>0 && comment[len-1]==')' )
+                comment = comment.substr(0,len-1);
             comment = RemoveLineEnds(comment);
             if( comment != "" )
             {
@@ -848,29 +687,6 @@ bool GameDocument::PgnParse( bool use_semi, int &nbr_converted, const std::strin
                 add_error_comment_here->game_move.comment += comment;
             }
         }
-
-        // Next character
-        else if( !eof )
-        {
-            if( push_back )
-                ch = push_back;
-            else
-            {
-                previous_ch = ch;
-                if( str_idx < str.length() )
-                {
-                    ch = str[str_idx];
-                    prefix += ch;
-                }
-                else
-                {
-                    ch  = ' ';  // add trailing padding to terminate last token
-                    if( str_idx > str.length()+2 )
-                        eof = true;   // after a trailing ' ' or so, stop
-                }
-                str_idx++;
-            }
-        }
     }
     if( was_empty && okay && buffered_comment!="" )
         tree.game_move.comment = buffered_comment;  // just a comment
@@ -2119,69 +1935,10 @@ bool GameDocument::IsAtEnd()
 
 void GameDocument::ToFileTxtGameDetails( std::string &str )
 {
-    #ifdef _WINDOWS
-    #define EOL "\r\n"
-    #else
-    #define EOL "\n"
-    #endif
-    std::string str1;
-    str1 += "[Event \"";
-    str1 += (r.event=="" ? "?" : r.event);
-    str1 += "\"]" EOL;
-    str1 += "[Site \"";
-    str1 += (r.site=="" ? "?" : r.site);
-    str1 += "\"]" EOL;
-    str1 += "[Date \"";
-    str1 += (r.date=="" ? "????.??.??" : r.date);
-    str1 += "\"]" EOL;
-    str1 += "[Round \"";
-    str1 += (r.round=="" ? "?": r.round);
-    str1 += "\"]" EOL;
-    str1 += "[White \"";
-    str1 += (r.white=="" ? "?": r.white);
-    str1 += "\"]" EOL;
-    str1 += "[Black \"";
-    str1 += (r.black=="" ? "?": r.black);
-    str1 += "\"]" EOL;
-    str1 += "[Result \"";
-    str1 += (r.result=="" ? "*" : r.result);
-    str1 += "\"]" EOL;
-    if( r.white_elo != "" )
-    {
-        str1 += "[WhiteElo \"";
-        str1 += r.white_elo;
-        str1 += "\"]" EOL;
-    }
-    if( r.black_elo != "" )
-    {
-        str1 += "[BlackElo \"";
-        str1 += r.black_elo;
-        str1 += "\"]" EOL;
-    }
-    if( r.eco != "" )
-    {
-        str1 += "[ECO \"";
-        str1 += r.eco;
-        str1 += "\"]" EOL;
-    }
     thc::ChessPosition tmp;
     bool needs_fen = (tmp!=start_position);
-    if( needs_fen )
-    {
-        str1 += "[FEN \"";
-        str1 += start_position.ForsythPublish();
-        str1 += "\"]" EOL;
-    }
-    for( std::pair<std::string,std::string> key_value: extra_tags )
-    {
-        str1 += "[";
-        str1 += key_value.first;    // key
-        str1 += " \"";
-        str1 += key_value.second;    // value
-        str1 += "\"]" EOL;
-    }
-    str1 += EOL;
-    str = str1;
+    str.clear();
+    PgnTagsFormat( r, needs_fen ? start_position.ForsythPublish() : std::string(), &extra_tags, str );
 }
 
 void GameDocument::ToFileTxtGameBody( std::string &str )
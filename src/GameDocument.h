@@ -46,24 +46,31 @@ public:
         }
         return moves;
     }
-    std::string blob_recalculated_on_request;
+    // The compressed moves are kept, and only calculated again if the main line (or the
+    //  start position) has changed since. The promotion attribute is kept up to date with them
     virtual const char *CompressedMoves()
     {
-        blob_recalculated_on_request.clear();
-        CompressMoves press;
-        if( press.cr == start_position )
+        std::vector<MoveTree> &variation = tree.variations[0];
+        bool same = blob_valid && blob_start_position==start_position && blob_moves.size()==variation.size();
+        for( unsigned int i=0; same && i<variation.size(); i++ )
+            same = (variation[i].game_move.move == blob_moves[i]);
+        if( !same )
         {
-            std::vector<thc::Move> moves;
-            std::vector<MoveTree> &variation = tree.variations[0];
+            blob_moves.clear();
             for( unsigned int i=0; i<variation.size(); i++ )
-            {
-                thc::Move mv = variation[i].game_move.move;
-                moves.push_back(mv);
-            }
-            blob_recalculated_on_request = press.Compress( moves );
+                blob_moves.push_back( variation[i].game_move.move );
+            blob_start_position = start_position;
+            blob_valid = true;
+            blob.clear();
+            CompressMoves press;
+            if( press.cr == start_position )
+                blob = press.Compress( blob_moves );
+            ListableGame::CalculatePromotionAttribute( blob.c_str(), blob.length() );
         }
-        return blob_recalculated_on_request.c_str();
+        return blob.c_str();
     }
+    virtual void CalculatePromotionAttribute() { CompressedMoves(); }
+    virtual void EnsurePromotionAttribute()    { CompressedMoves(); }
     virtual thc::ChessPosition &RefStartPosition() { return start_position; }
 
     // For now at least, the following are used for fast sorting on column headings
@@ -150,6 +157,12 @@ public:
     uint32_t    from_database_tag=0;
     uint32_t    from_clipboard_tag=0;
 
+    // CompressedMoves() cache, the main line moves and start position it was calculated from
+    std::string blob;
+    std::vector<thc::Move> blob_moves;
+    thc::ChessPosition blob_start_position;
+    bool        blob_valid=false;
+
     thc::ChessPosition start_position;  // the start position
     int64_t fposn0;       // offset of prefix in .pgn file
     int64_t fposn1;       // offset of tags in .pgn file
@@ -43,8 +43,10 @@
 #include "DbDialog.h"
 #include "Objects.h"
 #include "CompressMoves.h"
+#include "BitboardPosition.h"
 #include "Tabs.h"
 #include "Database.h"
+#include "Repertoire.h"
 using namespace std;
 using namespace thc;
 
@@ -1315,6 +1317,105 @@ void GameLogic::CmdDatabasePlayers()
     CmdDatabase( cr, REQ_PLAYERS );
 }
 
+// How far the current game follows database games, one batch search for all the
+//  positions of the main line rather than a position search for each of them
+void GameLogic::CmdDatabaseNovelty()
+{
+    extern wxMutex *WaitForWorkerThread( const char *title );
+    wxMutex *ptr_mutex_tiny_database = WaitForWorkerThread( "Completing Initial Database Load" );
+    wxMutexLocker lock(*ptr_mutex_tiny_database);
+    std::string error_msg;
+    if( objs.db->IsSuspended() || !objs.db->IsOperational(error_msg) )
+    {
+        wxMessageBox( "The database is not loaded. Use the 'Select current database' command in the database menu "
+                      "to load one", "Database problem", wxOK|wxICON_ERROR );
+        return;
+    }
+    std::vector<thc::Move> moves = gd.RefMoves();
+    thc::ChessRules cr = gd.start_position;
+    std::vector<thc::ChessPosition> targets;
+    targets.push_back( cr );
+    for( size_t i=0; i<moves.size(); i++ )
+    {
+        cr.PlayMove( moves[i] );
+        targets.push_back( cr );
+    }
+    MemoryPositionSearch *mps = &objs.db->tiny_db;
+    mps->SetFilter( MpsFilter() );
+    std::vector<MpsBatchResult> results;
+    {
+        ProgressBar progress("Searching Database", "Searching",false);
+        mps->DoBatchSearch( targets, &progress, results, true );
+    }
+
+    // A line per move while the game follows database games, then the novelty
+    std::string report;
+    cr = gd.start_position;
+    size_t ply;
+    for( ply=0; ply<moves.size(); ply++ )
+    {
+        char buf[200];
+        std::string move_txt = moves[ply].NaturalOut(&cr);
+        int move_nbr = cr.full_move_count;
+        bool white = cr.white;
+        cr.PlayMove( moves[ply] );
+        const MpsBatchResult &r = results[ply+1];
+        int total_games = r.games_found.size();
+        if( total_games == 0 )
+        {
+            sprintf( buf, "%d%s%s is a novelty\n", move_nbr, white?".":"...", move_txt.c_str() );
+            report += buf;
+            break;
+        }
+        int total_draws_plus_no_result = total_games - r.stats.total_white_wins - r.stats.total_black_wins;
+        double percent_score = ((1.0*r.stats.total_white_wins + 0.5*total_draws_plus_no_result) * 100.0) / total_games;
+        sprintf( buf, "%d%s%s  %d %s, white scores %.1f%%\n", move_nbr, white?".":"...", move_txt.c_str(),
+                    total_games, total_games==1 ? "game" : "games", percent_score );
+        report += buf;
+    }
+    if( moves.size() == 0 )
+        report = "The game has no moves";
+    else if( ply == moves.size() )
+        report += "Every position of the game is in the database";
+    else if( results[0].games_found.size() == 0 )
+        report = "The game's start position isn't in the database";
+    wxMessageBox( report.c_str(), "Database novelty", wxOK );
+}
+
+// Database coverage of a repertoire (the current game and its variations), in a new
+//  tab as the repertoire annotated with game counts and its popular missing moves
+void GameLogic::CmdDatabaseRepertoire()
+{
+    extern wxMutex *WaitForWorkerThread( const char *title );
+    wxMutex *ptr_mutex_tiny_database = WaitForWorkerThread( "Completing Initial Database Load" );
+    wxMutexLocker lock(*ptr_mutex_tiny_database);
+    std::string error_msg;
+    if( objs.db->IsSuspended() || !objs.db->IsOperational(error_msg) )
+    {
+        wxMessageBox( "The database is not loaded. Use the 'Select current database' command in the database menu "
+                      "to load one", "Database problem", wxOK|wxICON_ERROR );
+        return;
+    }
+    Atomic begin;
+    GameDocument temp = gd;
+    GameDocument new_gd = gd;
+    MemoryPositionSearch *mps = &objs.db->tiny_db;
+    mps->SetFilter( MpsFilter() );
+    RepertoireCoverage rc;
+    {
+        ProgressBar progress("Searching Database", "Searching",false);
+        rc.Calculate( new_gd.tree, *mps, &mps->in_memory_game_cache, &progress );
+    }
+    rc.Annotate( new_gd.tree );
+    new_gd.Rebuild();
+    new_gd.game_being_edited = 0;
+    new_gd.modified = true;
+    tabs->TabNew(new_gd);
+    ShowNewDocument();
+    atom.NotUndoAble();  // don't save an undo position
+    objs.session->SaveGame(&temp);      // ...modify session only after loading old game
+}
+
 void GameLogic::CmdDatabase( thc::ChessRules &cr, DB_REQ db_req, PatternParameters *parm )
 {
     static int count;
@@ -4629,7 +4730,7 @@ void GameLogic::KibitzUpdate( int idx, const char *txt )
         {
             thc::Move move;
             std::string nmove;
-            bool have_move = move.TerseIn( &cr, txt2 );
+            bool have_move = BitboardTerseIn( move, &cr, txt2 );
             if( !have_move )
                 break;
             else
@@ -4642,7 +4743,7 @@ void GameLogic::KibitzUpdate( int idx, const char *txt )
                 var.push_back( move );
                 wxString mv;
                 bool white=cr.WhiteToPlay();
-                nmove = move.NaturalOut(&cr);
+                nmove = BitboardNaturalOut(move,&cr);
                 LangOut(nmove);
                 if( white || i==0 )
                     mv.sprintf( " %d%s%s", cr.full_move_count, white?".":"...",nmove.c_str() );
@@ -4778,7 +4879,7 @@ void GameLogic::KibitzUpdateEngineToMove( bool ponder, unsigned int idx, const c
             }
             else
             {
-                have_move = move.TerseIn( &cr, txt2 );
+                have_move = BitboardTerseIn( move, &cr, txt2 );
                 if( have_move )
                 {
                     txt2 += 4;
@@ -4795,7 +4896,7 @@ void GameLogic::KibitzUpdateEngineToMove( bool ponder, unsigned int idx, const c
                 var.push_back( move );
                 wxString mv;
                 bool white2=cr.WhiteToPlay();
-                nmove = move.NaturalOut(&cr);
+                nmove = BitboardNaturalOut(move,&cr);
                 LangOut(nmove);
                 if( white2 || i==0 )
                     mv.sprintf( " %d%s%s", cr.full_move_count, white2?".":"...",nmove.c_str() );
@@ -101,6 +101,8 @@ public:
     void CmdDatabaseAppend();
     void CmdDatabasePattern();
     void CmdDatabaseMaterial();
+    void CmdDatabaseNovelty();
+    void CmdDatabaseRepertoire();
 
     void CmdDatabase( thc::ChessRules &cr, DB_REQ db_req, PatternParameters *parm=NULL );
     void CmdNextGame();
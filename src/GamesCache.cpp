@@ -7,6 +7,7 @@
 #include <time.h> // time_t
 #include <stdio.h>
 #include <set>
+#include <algorithm>
 #include "wx/wx.h"
 #include "wx/valtext.h"
 #include "wx/valgen.h"
@@ -28,6 +29,7 @@
 #include "Log.h"
 #include "Eco.h"
 #include "GamesCache.h"
+#include "PgnStreamWriter.h"
 #include "fseek64.h"
 using namespace std;
 
@@ -285,11 +287,23 @@ bool GamesCache::Load( FILE *pgn_file )
         done = PgnStateMachine( pgn_file, typ, buf, sizeof(buf) );
         if( typ == 'G' )
         {
-            ListableGamePgn pgn_document(pgn_handle,fposn);
+
+            // Note where the game ends too, so it can be copied verbatim on save. Not if the
+            //  state machine padded the final blank line (i.e. more than one newline), then
+            //  the file text isn't quite what the state machine delivers
+            int64_t fposn_next = done ? 0 : ftell64(pgn_file);
+            int nbr_newlines = 0;
+            for( const char *p=buf; *p; p++ )
+            {
+                if( *p == '\n' )
+                    nbr_newlines++;
+            }
+            int64_t fposn_end = (nbr_newlines==1 ? fposn_next : 0);
+            ListableGamePgn pgn_document(pgn_handle,fposn,fposn_end);
             make_smart_ptr( ListableGamePgn, new_doc, pgn_document );
             gds.push_back( std::move(new_doc) );
             if( !done )
-                fposn = ftell64(pgn_file);
+                fposn = fposn_next;
             game_count++;
         }
         pb.ProgressFile();
@@ -328,9 +342,15 @@ void *ReadGameFromPgnInLoop( int pgn_handle, int64_t fposn, CompactGame &pact, v
     static int new_count;
     static FILE *pgn_file;
     static int save_pgn_handle;
+    static PgnRead *spare;  // kept between calls, so its move arenas are reused
     PgnRead *pgn;
     if( context )
         pgn = static_cast<PgnRead*>( context );
+    else if( spare )
+    {
+        pgn = spare;
+        spare = NULL;
+    }
     else
     {
         pgn = new PgnRead('R');
@@ -364,7 +384,8 @@ void *ReadGameFromPgnInLoop( int pgn_handle, int64_t fposn, CompactGame &pact, v
         objs.gl->pf.Close();
         pgn_file = NULL;
         save_pgn_handle = 0;
-        delete pgn;
+        delete spare;
+        spare = pgn;
         pgn = 0;
     }
     //cprintf( "ReadGameFromPgnInLoop(%d,%s) %ld (%s-%s)\n", pgn_handle, end?"true":"false", fposn, pact.r.white.c_str(), pact.r.black.c_str() );
@@ -620,7 +641,7 @@ void GamesCache::FileSaveInner( FILE *pgn_out )
     file_irrevocably_modified = false;
     buf = new char [buflen];
     int gds_nbr = gds.size();
-    long write_posn=0;
+    PgnStreamWriter ws(pgn_out);    // all output goes through here, ws.Posn() is the write position
     bool saving_work_file = (this==&objs.gl->gc_pgn);
     int nbr_locked=0, nbr_game_documents=0, nbr_emergency_games_written=0;
     int nbr_unavailable_games=0, nbr_unavailable_files=0;
@@ -660,11 +681,40 @@ void GamesCache::FileSaveInner( FILE *pgn_out )
     bool reached_limit=false;
     int count_to_limit=0, nbr_omitted=0, count_to_expected_total_games=0;
     nbr_locked=0;
+
+    // Games that only have compressed moves are formatted a batch at a time on all
+    //  cores, then written out in order along with everything else
+    std::vector<PgnStreamJob> jobs(PGN_STREAM_BATCH);
+    std::vector<int> batch_jobs(PGN_STREAM_BATCH);
+    int batch_begin=0, batch_end=0;
     for( int i=0; i<gds_nbr; i++ )
     {
         bool abort = pb.Perfraction( count_to_expected_total_games, expected_total_games );
         if( abort )
             break;
+        if( i >= batch_end )
+        {
+            batch_begin = i;
+            batch_end = std::min( i+PGN_STREAM_BATCH, gds_nbr );
+            int nbr_jobs = 0;
+            for( int j=batch_begin; j<batch_end; j++ )
+            {
+                ListableGame *p = gds[j].get();
+                int pgn_handle3;
+                batch_jobs[j-batch_begin] = -1;
+                if( !p->IsGameDocument() && !p->GetPgnHandle(pgn_handle3) )
+                {
+                    PgnStreamJob &job = jobs[nbr_jobs];
+                    job.r = p->RefRoster();
+                    if( job.r.fen == "" )     // blob decoding assumes the standard starting position
+                    {
+                        job.blob = p->CompressedMoves();
+                        batch_jobs[j-batch_begin] = nbr_jobs++;
+                    }
+                }
+            }
+            PgnStreamFormatParallel( jobs, nbr_jobs );
+        }
         ListableGame *mptr = gds[i].get();
         if( mptr->TestLocked()  )
         {
@@ -688,7 +738,6 @@ void GamesCache::FileSaveInner( FILE *pgn_out )
         mptr->saved = true;
         int pgn_handle2;
         bool is_pgn = mptr->GetPgnHandle(pgn_handle2);
-        long game_len = 0;
         if( is_pgn )
         {
 
@@ -698,27 +747,78 @@ void GamesCache::FileSaveInner( FILE *pgn_out )
 
                 // Read data from a .pgn
                 int64_t fposn = mptr->GetFposn();
-
-                // If we are copying the file, update the position to be the new write position in the file
-                if( pgn_handle == pgn_handle2 )
-                    mptr->SetFposn( write_posn );
+                int64_t fposn_end = mptr->GetFposnEnd();
+                int64_t write_posn = ws.Posn();
+                int64_t write_end = 0;
 
                 // Get FILE * for reading - note this doesn't usually require a new fopen()
                 FILE *pgn_in2 = objs.gl->pf.ReopenRead( pgn_handle2);
                 if( pgn_in2 )
                 {
-                    fseek64( pgn_in2, fposn, SEEK_SET );
-                    char buf2[2048];
-                    int typ;
-                    bool done = PgnStateMachine( NULL, typ,  buf2, sizeof(buf2) );
-                    while( !done )
+
+                    // An unmodified game whose extent in the file is known is copied verbatim,
+                    //  together with any unmodified games that follow it contiguously in the
+                    //  same file, so a long run becomes one big copy. Otherwise it's re-read
+                    //  line by line
+                    int run_last = i;
+                    int64_t run_end = fposn_end;
+                    while( fposn_end>fposn && run_last+1<gds_nbr )
                     {
-                        done = PgnStateMachine( pgn_in2, typ,  buf2, sizeof(buf2) );
-                        fputs( buf2, pgn_out );
-                        game_len += strlen(buf2);
-                        if( typ == 'G' )
+                        ListableGame *next = gds[run_last+1].get();
+                        int pgn_handle3;
+                        if( next->TestLocked() || !next->GetPgnHandle(pgn_handle3) || pgn_handle3!=pgn_handle2
+                            || next->GetFposn()!=run_end || next->GetFposnEnd()<=run_end )
                             break;
+                        run_end = next->GetFposnEnd();
+                        run_last++;
+                    }
+                    bool copied = (run_last>i && ws.CopyRange( pgn_in2, fposn, run_end-fposn ));
+                    if( copied )
+                    {
+                        for( int j=i+1; j<=run_last; j++ )
+                        {
+                            ListableGame *p = gds[j].get();
+                            count_to_expected_total_games++;
+                            p->saved = true;
+                            if( pgn_handle == pgn_handle2 )
+                            {
+                                p->SetFposnEnd( write_posn + (p->GetFposnEnd()-fposn) );
+                                p->SetFposn( write_posn + (p->GetFposn()-fposn) );
+                            }
+                        }
+                        write_end = write_posn + (fposn_end-fposn);
+                        i = run_last;
                     }
+                    else if( !ws.Failed() )
+                        copied = (fposn_end > fposn && ws.CopyRange( pgn_in2, fposn, fposn_end-fposn ));
+                    if( ws.Failed() )
+                    {
+                        mptr->saved = false;    // the copy failed part way, give up (reported below)
+                        break;
+                    }
+                    if( !copied )
+                    {
+                        fseek64( pgn_in2, fposn, SEEK_SET );
+                        char buf2[2048];
+                        int typ;
+                        bool done = PgnStateMachine( NULL, typ,  buf2, sizeof(buf2) );
+                        while( !done )
+                        {
+                            done = PgnStateMachine( pgn_in2, typ,  buf2, sizeof(buf2) );
+                            ws.Write( buf2 );
+                            if( typ == 'G' )
+                                break;
+                        }
+                    }
+                    if( write_end == 0 )
+                        write_end = ws.Posn();
+                }
+
+                // If we are copying the file, update the position to be the new write position in the file
+                if( pgn_handle == pgn_handle2 )
+                {
+                    mptr->SetFposn( write_posn );
+                    mptr->SetFposnEnd( write_end>write_posn ? write_end : 0 );
                 }
             }
         }
@@ -744,11 +844,19 @@ void GamesCache::FileSaveInner( FILE *pgn_out )
                     objs.tabs->Iterate(handle,pd,pu);
                 }
             }
-            const char* blob=0;
+
+            // Games with only compressed moves were formatted straight to SAN text
+            //  above, no GameDocument (and so no MoveTree) is built for them
+            bool streamed = false;
             if( !ptr )
             {
-                blob = mptr->CompressedMoves();
-                if( !blob )
+                int job = batch_jobs[i-batch_begin];
+                if( job >= 0 )
+                {
+                    ws.Write( jobs[job].txt );
+                    streamed = true;
+                }
+                else
                 {
                     mptr->ConvertToGameDocument(gd_temp);
                     ptr = &gd_temp;
@@ -759,27 +867,14 @@ void GamesCache::FileSaveInner( FILE *pgn_out )
 #else
 #define EOL "\n"
 #endif
-            if( blob )
-            {
-                gd_temp.r = mptr->RefRoster();
-                std::string str;
-                gd_temp.ToFileTxtGameDetails(str);
-                fwrite(str.c_str(), 1, str.length(), pgn_out);
-                game_len += str.length();
-                CompressMoves comp;
-                str = comp.ToNaturalMoves( std::string(blob), gd_temp.r.result );
-                str += EOL;
-                fwrite(str.c_str(), 1, str.length(), pgn_out);
-                game_len += str.length();
-            }
-            else
+            if( !streamed )
             {
                 ptr->modified = false;
                 ptr->game_prefix_edited = false;
                 ptr->game_details_edited = false;
                 ptr->pgn_handle = pgn_handle;  // irrespective of where it came from, now this
                                                //  game is in this file
-                ptr->fposn0 = write_posn;      // at this position
+                ptr->fposn0 = ws.Posn();       // at this position
                                                // This worried me one time I looked at it - what if it's say a DB game?
                                                //  in that case we are only changing the gd_temp *temporary* document
                 std::string s = ptr->prefix_txt;
@@ -787,34 +882,35 @@ void GamesCache::FileSaveInner( FILE *pgn_out )
                 if( len > 0 )
                 {
                     if( i != 0 )    // blank line needed before all but first prefix
-                    {
-                        fwrite(EOL, 1, strlen(EOL), pgn_out);
-                        game_len += strlen(EOL);
-                    }
-                    fwrite(s.c_str(), 1, len, pgn_out);
-                    game_len += len;
-                    fwrite(EOL, 1, strlen(EOL), pgn_out);
-                    game_len += strlen(EOL);
+                        ws.Write( EOL );
+                    ws.Write( s.c_str(), len );
+                    ws.Write( EOL );
                 }
-                ptr->fposn1 = write_posn + game_len;
+                ptr->fposn1 = ws.Posn();
                 std::string str;
                 GameDocument temp = *ptr;
                 temp.r = mptr->RefRoster();
                 temp.ToFileTxtGameDetails(str);
-                fwrite(str.c_str(), 1, str.length(), pgn_out);
-                game_len += str.length();
-                ptr->fposn2 = write_posn + game_len;
+                ws.Write( str );
+                ptr->fposn2 = ws.Posn();
                 temp.ToFileTxtGameBody(str);
-                fwrite(str.c_str(), 1, str.length(), pgn_out);
-                game_len += str.length();
-                ptr->fposn3 = write_posn + game_len;
+                ws.Write( str );
+                ptr->fposn3 = ws.Posn();
                 if( save_changes_back_to_tab )
                     *save_changes_back_to_tab = *ptr;
             }
         }
-        write_posn += game_len;
     }
+    ws.Finish();
     delete[] buf;
+    if( ws.Failed() )
+    {
+        file_irrevocably_modified = true;   // so the work isn't considered saved
+        wxString msg =
+            "Error: The file could not be read or written completely, the saved file is incomplete.\n"
+            "Please save any work in progress to a fresh file.\n";
+        FileConflictError( msg, true );
+    }
     if( reached_limit )
     {
         wxString msg;
@@ -975,7 +1071,7 @@ void GamesCache::Eco(  GamesCache *gc_clipboard )
         std::string eco  = mptr->Eco();
         std::string blob = mptr->CompressedMoves();
         const char *file = eco.c_str();
-        const char *calc = eco_calculate(blob);
+        const char *calc = eco_calculate(mptr->game_id,blob);
         bool match = (0==strcmp(file,calc));
         if( match )
             successes++;
@@ -18,6 +18,7 @@
 #endif
 #include "Appdefs.h"
 #include "DebugPrintf.h"
+#include "DecodeCache.h"
 #include "thc.h"
 #include "GameDetailsDialog.h"
 #include "TournamentDialog.h"
@@ -296,7 +297,10 @@ std::string GamesListCtrl::CalculateMoveTxt( std::string &previous_move, Compact
     std::string move_txt;
     thc::ChessRules cr=info.GetStartPosition();
     int nbr_moves = info.moves.size();
-    for( int i=0; i<nbr_moves; i++ )
+
+    // Start from a decode cache snapshot rather than replaying from the start of the game
+    int first = gbl_decode_cache.Snapshot( info.game_id, info.moves, focus_offset>0?focus_offset-1:0, cr );
+    for( int i=first; i<nbr_moves; i++ )
     {
         thc::Move mv = info.moves[i];
         if( i>=focus_offset || i+1==focus_offset )
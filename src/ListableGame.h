@@ -32,6 +32,8 @@ public:
     virtual void ConvertToGameDocument(GameDocument &UNUSED(gd)) {}
     virtual int64_t GetFposn() { return 0; }
     virtual void SetFposn( int64_t UNUSED(posn) ) {}
+    virtual int64_t GetFposnEnd() { return 0; }         // 0 if the end of the game's text isn't known
+    virtual void SetFposnEnd( int64_t UNUSED(posn) ) {}
     virtual bool GetPgnHandle( int &UNUSED(pgn_handle) ) { return false; }
     virtual void SetPgnHandle( int UNUSED(pgn_handle) )  {}
     virtual bool IsModified()        { return false; }
@@ -80,13 +82,15 @@ public:
     }
 private:
     uint8_t  game_attributes;    // At the moment there are two attributes, promotion (game has at least one
-                                 //  pawn promotion) and locked (restrict game export to PGN)
+                                 //  pawn promotion) and locked (restrict game export to PGN), plus a flag
+                                 //  indicating the promotion attribute has been set
 
 public:
     uint32_t game_id;
     bool     saved;
     bool TestPromotion() { return (game_attributes&1) ? true : false; }
-    void SetPromotion( bool has_promotion ) { if( has_promotion ) game_attributes |= 1; else game_attributes &= (~1); }
+    void SetPromotion( bool has_promotion ) { if( has_promotion ) game_attributes |= 1; else game_attributes &= (~1); game_attributes |= 4; }
+    bool TestPromotionKnown() { return (game_attributes&4) ? true : false; }
     bool TestLocked() { return (game_attributes&2) ? true : false; }
     void SetLocked( bool is_locked ) { if( is_locked ) game_attributes |= 2; else game_attributes &= (~2); }
     virtual void CalculatePromotionAttribute( const char *blob, int len )
@@ -126,6 +130,9 @@ public:
         }
         SetPromotion( has_promotion );
     }
+
+    // Searches need the promotion attribute, calculate it unless it's already known
+    virtual void EnsurePromotionAttribute() { if( !TestPromotionKnown() ) CalculatePromotionAttribute(); }
     virtual bool UsesControlBlock( uint8_t & ) { return false; }
 
 };
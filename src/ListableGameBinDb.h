@@ -60,8 +60,8 @@ public:
 
     virtual void GetCompactGame( CompactGame &pact )
     {
+        pact.game_id = game_id;     // before Unpack(), so it can use the decode cache
         pack.Unpack(pact);
-        pact.game_id = game_id;
     }
 
     virtual void ConvertToGameDocument(GameDocument &gd)
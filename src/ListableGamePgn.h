@@ -20,12 +20,15 @@ class ListableGamePgn : public ListableGame
 private:
     int  pgn_handle;
     int64_t fposn;
+    int64_t fposn_end;      // one past the game's text in the file, 0 if not known
     PackedGame pack;
     bool in_memory;
 public:
-    ListableGamePgn( int pgn_handle, int64_t fposn ) { this->pgn_handle=pgn_handle, this->fposn = fposn; in_memory=false;  }
+    ListableGamePgn( int pgn_handle, int64_t fposn, int64_t fposn_end=0 ) { this->pgn_handle=pgn_handle, this->fposn = fposn; this->fposn_end = fposn_end; in_memory=false;  }
     virtual int64_t GetFposn() { return fposn; }
     virtual void SetFposn( int64_t posn ) { fposn=posn; }
+    virtual int64_t GetFposnEnd() { return fposn_end; }
+    virtual void SetFposnEnd( int64_t posn ) { fposn_end=posn; }
     virtual bool GetPgnHandle( int &pgn_handle_ ) { pgn_handle_=this->pgn_handle; return true; }
     virtual void SetPgnHandle( int pgn_handle_ )  { this->pgn_handle = pgn_handle_; }
     virtual void *LoadIntoMemory( void *context, bool end )
@@ -35,6 +38,8 @@ public:
             CompactGame pact;
             context = ReadGameFromPgnInLoop( pgn_handle, fposn, pact, context, end );
             pack.Pack(pact);
+            const char *blob = pack.Blob();
+            CalculatePromotionAttribute( blob, strlen(blob) );
         }
         in_memory = true;
         return context;
@@ -44,8 +49,8 @@ public:
     {
         if( pack.Empty() )
             LoadIntoMemory( NULL, true );
+        pact.game_id = game_id;     // before Unpack(), so it can use the decode cache
         pack.Unpack(pact);
-        pact.game_id = game_id;
     }
 
     // For editing the roster
@@ -14,6 +14,8 @@
 #include "Appdefs.h"
 #include "DbPrimitives.h"
 #include "DbMaintenance.h"
+#include "Objects.h"
+#include "GameLogic.h"
 #include "MaintenanceDialog.h"
 
 // MaintenanceDialog type definition
@@ -377,6 +379,20 @@ void MaintenanceDialog::SetDialogHelp()
 // wxEVT_COMMAND_BUTTON_CLICKED event handler for ID_MAINTENANCE_CMD_1
 void MaintenanceDialog::OnMaintenanceSpeed( wxCommandEvent& WXUNUSED(event) )
 {
+    // Decode the games we have loaded (database first), if any
+    std::vector<std::string> blobs;
+    GamesCache *caches[2] = { &objs.gl->gc_database, &objs.gl->gc_pgn };
+    for( int i=0; i<2 && blobs.size()==0; i++ )
+    {
+        for( smart_ptr<ListableGame> &mptr: caches[i]->gds )
+        {
+            if( blobs.size() >= 100000 )
+                break;
+            if( mptr->RefRoster().fen == "" )
+                blobs.push_back( mptr->CompressedMoves() );
+        }
+    }
+    db_maintenance_decode_speed( blobs );
 }
 
 // wxEVT_COMMAND_BUTTON_CLICKED event handler for ID_MAINTENANCE_CMD_4
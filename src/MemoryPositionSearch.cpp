@@ -7,6 +7,10 @@
 #include <algorithm>
 #include <vector>
 #include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
 #include <wx/utils.h>
 #include "AutoTimer.h"
 #include "ProgressBar.h"
@@ -123,6 +127,17 @@ void MemoryPositionSearch::Init()
     in_memory_game_cache.clear();
     search_position_set=false;
     search_source = &in_memory_game_cache;
+    nbr_threads_requested = 0;
+    search_pass = NULL;
+    search_calculate_stats = false;
+    search_nbr_chunks = 0;
+    search_next_chunk = 0;
+    filter = MpsFilter();
+    columns.Clear();
+    filter_pass.clear();
+    position_stats_valid = false;
+    pattern_first_ply = 0;
+    pattern_last_ply  = 0xffff;
     thc::ChessPosition *cp = static_cast<thc::ChessPosition *>(&msi.cr);
     cp->Init();
     msi.cr.squares[ thc::c1 ] = 'D';     // Impose the distinct dark squared bishop = 'd'/'D' convention over the top
@@ -274,17 +289,169 @@ bool MemoryPositionSearch::TryFastMode( MpsSide *side )
     return okay;
 }
 
-int  MemoryPositionSearch::DoSearch( const thc::ChessPosition &cp, ProgressBar *progress )
+// A new filter means the last search's results are no longer this search's results
+void MemoryPositionSearch::SetFilter( const MpsFilter &f )
 {
-    return DoSearch(cp,progress,&in_memory_game_cache);
+    if( !(f == filter) )
+    {
+        filter = f;
+        search_position_set = false;
+    }
 }
 
-int  MemoryPositionSearch::DoSearch( const thc::ChessPosition &cp, ProgressBar *progress, std::vector< smart_ptr<ListableGame> > *source )
+// Test every game of the source against the filter, returns a pass flag per game
+//  (or NULL if there's no filter)
+const uint8_t *MemoryPositionSearch::FilterGames( std::vector< smart_ptr<ListableGame> > *source )
+{
+    if( !filter.IsActive() )
+        return NULL;
+    size_t nbr = source->size();
+    if( nbr == 0 )
+        return NULL;
+    if( columns.source!=source || columns.date.size()!=nbr ||
+        columns.first_game_id!=(*source)[0]->game_id || columns.last_game_id!=(*source)[nbr-1]->game_id )
+    {
+        AutoTimer at("Filter columns");
+        columns.Clear();
+        columns.source = source;
+        columns.first_game_id = (*source)[0]->game_id;
+        columns.last_game_id  = (*source)[nbr-1]->game_id;
+        columns.white_elo.resize(nbr);
+        columns.black_elo.resize(nbr);
+        columns.date.resize(nbr);
+        columns.result.resize(nbr);
+        for( size_t i=0; i<nbr; i++ )
+        {
+            ListableGame *p = (*source)[i].get();
+            columns.white_elo[i] = static_cast<uint16_t>( p->WhiteEloBin() );
+            columns.black_elo[i] = static_cast<uint16_t>( p->BlackEloBin() );
+            columns.date[i]      = static_cast<uint32_t>( p->DateBin() );
+            columns.result[i]    = static_cast<uint8_t>( p->ResultBin() & 3 );
+        }
+    }
+    filter_pass.resize(nbr);
+    uint16_t min_elo  = static_cast<uint16_t>( std::min(filter.min_elo,4095) );
+    uint32_t min_date = filter.min_date;
+    uint32_t max_date = filter.max_date ? filter.max_date : 0xffffffff;
+    unsigned int result_mask = filter.result_mask ? filter.result_mask : 0xf;
+    const uint16_t *white_elo = &columns.white_elo[0];
+    const uint16_t *black_elo = &columns.black_elo[0];
+    const uint32_t *date      = &columns.date[0];
+    const uint8_t  *result    = &columns.result[0];
+    uint8_t *pass = &filter_pass[0];
+    for( size_t i=0; i<nbr; i++ )
+    {
+        pass[i] = static_cast<uint8_t>( (white_elo[i]>=min_elo) & (black_elo[i]>=min_elo) &
+                                        (date[i]>=min_date) & (date[i]<=max_date) &
+                                        ((result_mask>>result[i]) & 1) );
+    }
+    return pass;
+}
+
+int  MemoryPositionSearch::DoSearch( const thc::ChessPosition &cp, ProgressBar *progress, bool calculate_stats )
+{
+    return DoSearch(cp,progress,&in_memory_game_cache,calculate_stats);
+}
+
+int  MemoryPositionSearch::DoSearch( const thc::ChessPosition &cp, ProgressBar *progress, std::vector< smart_ptr<ListableGame> > *source, bool calculate_stats )
+{
+    AutoTimer at("Search time");
+    DoSearchStart( cp, source, calculate_stats );
+    return DoSearchContinue( INT_MAX, progress );
+}
+
+// Start a search that finds games a few at a time, with DoSearchContinue()
+void MemoryPositionSearch::DoSearchStart( const thc::ChessPosition &cp, std::vector< smart_ptr<ListableGame> > *source, bool calculate_stats )
 {
     games_found.clear();
-    search_position = cp;
     search_position_set = true;
     search_source = source;
+    position_stats.Clear();
+    position_stats_valid = false;
+    search_calculate_stats = calculate_stats;
+    DoSearchPrime( cp );
+    search_pass = FilterGames( source );
+    search_nbr_chunks = (static_cast<int>(source->size())+MPS_SEARCH_CHUNK-1) / MPS_SEARCH_CHUNK;
+    search_next_chunk = 0;
+}
+
+// Search on until at least nbr_wanted games have been found, or all games have been
+//  searched. Games are found in source order, so the games found so far are the first
+//  games found by a complete search. Returns the number of games found so far
+int  MemoryPositionSearch::DoSearchContinue( int nbr_wanted, ProgressBar *progress )
+{
+    std::vector< smart_ptr<ListableGame> > *source = search_source;
+    const uint8_t *pass = search_pass;
+    bool calculate_stats = search_calculate_stats;
+    const thc::ChessPosition cp = search_position;
+    int nbr = source->size();
+    int nbr_chunks = search_nbr_chunks;
+    int nbr_threads = nbr_threads_requested>0 ? nbr_threads_requested : std::thread::hardware_concurrency();
+    if( nbr_threads < 1 )
+        nbr_threads = 1;
+
+    // Chunks are searched a window at a time, so that the search can stop soon after enough
+    //  games are found. The window starts at a chunk per thread and doubles each time, a
+    //  complete search has just the one window
+    int window = nbr_wanted==INT_MAX ? nbr_chunks : nbr_threads;
+    while( search_next_chunk<nbr_chunks && static_cast<int>(games_found.size())<nbr_wanted )
+    {
+        int first_chunk = search_next_chunk;
+        int end_chunk   = std::min( first_chunk+window, nbr_chunks );
+        window *= 2;
+
+        // Shared out to threads in chunks as for DoPatternSearch() below. If stats
+        //  are wanted each thread gathers its own as it finds games, they're merged
+        //  at the end
+        int window_threads = std::min( nbr_threads, end_chunk-first_chunk );
+        std::vector< std::vector<DoSearchFoundGame> > chunks_found(end_chunk-first_chunk);
+        std::vector<PositionStats> threads_stats( calculate_stats ? window_threads : 0 );
+        std::atomic<int> next(first_chunk);
+        auto worker = [&]( MemoryPositionSearch &mps, PositionStats *stats_thread, ProgressBar *progress_thread )
+        {
+            for(;;)
+            {
+                int idx = next++;
+                if( idx >= end_chunk )
+                    break;
+                int begin = idx*MPS_SEARCH_CHUNK;
+                int end   = std::min( begin+MPS_SEARCH_CHUNK, nbr );
+                mps.SearchGames( source, begin, end, pass, chunks_found[idx-first_chunk], stats_thread );
+                if( progress_thread )
+                    progress_thread->Perfraction( std::min(next.load(),end_chunk), nbr_chunks );
+            }
+        };
+        std::vector<std::thread> pool;
+        for( int i=1; i<window_threads; i++ )
+        {
+            pool.push_back( std::thread( [&,i]()
+            {
+                MemoryPositionSearch mps;
+                mps.DoSearchPrime( cp );
+                worker( mps, calculate_stats ? &threads_stats[i] : NULL, NULL );
+            } ) );
+        }
+        worker( *this, calculate_stats ? &threads_stats[0] : NULL, progress );     // only this thread updates the progress bar
+        for( std::thread &t: pool )
+            t.join();
+        for( const PositionStats &s: threads_stats )
+            position_stats.Merge( s );
+        for( const std::vector<DoSearchFoundGame> &v: chunks_found )
+            games_found.insert( games_found.end(), v.begin(), v.end() );
+        search_next_chunk = end_chunk;
+    }
+    if( search_next_chunk>=nbr_chunks && calculate_stats && !position_stats_valid )
+    {
+        position_stats.Sort();
+        position_stats_valid = true;
+    }
+    return games_found.size();
+}
+
+// Set up the target position for DoSearch()
+void MemoryPositionSearch::DoSearchPrime( const thc::ChessPosition &cp )
+{
+    search_position = cp;
 
     // Set up counts of total pieces, and individual pieces in the target position
     ms.total_count_target = 64;     // reverse count non-pieces from 64
@@ -454,54 +621,200 @@ int  MemoryPositionSearch::DoSearch( const thc::ChessPosition &cp, ProgressBar *
     mq.rank8_target = *mq.rank8_target_ptr;
     mq.rank1_target = *mq.rank1_target_ptr;
     mq.rank2_target = *mq.rank2_target_ptr;
-    int nbr = source->size();
+}
+
+// Search games [begin,end) of source for the DoSearch() position, skipping games
+//  without a pass flag (if there are pass flags)
+void MemoryPositionSearch::SearchGames( std::vector< smart_ptr<ListableGame> > *source, int begin, int end, const uint8_t *pass,
+                                        std::vector<DoSearchFoundGame> &found, PositionStats *stats )
+{
+    // Leave only one defined
+    //#define CONSERVATIVE
+    //#define NO_PROMOTIONS_FLAWED
+    #define CORRECT_BEST_PRACTICE
+    for( int i=begin; i<end; i++ )
     {
-        AutoTimer at("Search time");
+        if( pass && !pass[i] )
+            continue;
+        const smart_ptr<ListableGame> &p = (*source)[i];
+        const char *fen = p->Fen();
+        if( fen && *fen )
+            continue;   // a partial game in the clipboard
+        DoSearchFoundGame dsfg;
+        dsfg.idx = i;
+        dsfg.game_id = p->game_id;
+        dsfg.offset_first=0;
+        dsfg.offset_last=0;
+        /* Roster r = in_memory_game_cache[i]->RefRoster();
+        cprintf( "idx=%d, white=%s[%s], black=%s[%s], blob=%s\n",
+                    in_memory_game_cache[i]->game_id,
+                    in_memory_game_cache[i]->White(),  r.white.c_str(),
+                    in_memory_game_cache[i]->Black(),  r.black.c_str(),
+                    in_memory_game_cache[i]->CompressedMoves() ); */
+        bool promotion_in_game = p->TestPromotion();
+        bool game_found;
+        #ifdef CONSERVATIVE
+        game_found = SearchGameSlowPromotionAllowed( std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
+        #endif
+        #ifdef NO_PROMOTIONS_FLAWED
+        game_found = SearchGameOptimisedNoPromotionAllowed( std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
+        #endif
+        #ifdef CORRECT_BEST_PRACTICE
+        if( promotion_in_game )
+            game_found = SearchGameSlowPromotionAllowed( std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
+        else
+            game_found = SearchGameOptimisedNoPromotionAllowed( p->CompressedMoves(), dsfg.offset_first, dsfg.offset_last );
+        #endif
+        if( game_found )
+        {
+            found.push_back( dsfg );
+            if( stats )
+                stats->AddGame( p->CompressedMoves(), p->ResultBin(), dsfg.offset_first, dsfg.offset_last );
+        }
+    }
+}
+
+// FNV-1a, a path's hash is built up one compressed move at a time so that
+//  FindTransposition() can try every path length in one pass over a game
+#define PATH_HASH_INIT 14695981039346656037ULL
+static inline uint64_t PathHashStep( uint64_t hash, char code )
+{
+    return (hash ^ static_cast<unsigned char>(code)) * 1099511628211ULL;
+}
+
+static uint64_t PathHash( const char *blob, size_t len )
+{
+    uint64_t hash = PATH_HASH_INIT;
+    for( size_t i=0; i<len; i++ )
+        hash = PathHashStep( hash, blob[i] );
+    return hash;
+}
+
+void PositionStats::Clear()
+{
+    total_white_wins = 0;
+    total_black_wins = 0;
+    total_draws = 0;
+    stats.clear();
+    transpositions.clear();
+    index.clear();
+    lengths.clear();
+}
+
+int PositionStats::Find( const char *blob, size_t len, uint64_t hash ) const
+{
+    auto range = index.equal_range(hash);
+    for( auto it=range.first; it!=range.second; ++it )
+    {
+        const std::string &path = transpositions[it->second].blob;
+        if( path.length()==len && 0==memcmp(path.c_str(),blob,len) )
+            return it->second;
+    }
+    return -1;
+}
+
+int PositionStats::Insert( const char *blob, size_t len, uint64_t hash )
+{
+    int idx = static_cast<int>(transpositions.size());
+    PATH_TO_POSITION ptp;
+    ptp.blob.assign( blob, len );
+    transpositions.push_back( ptp );
+    index.insert( std::make_pair(hash,idx) );
+    auto it = std::lower_bound( lengths.begin(), lengths.end(), len );
+    if( it==lengths.end() || *it!=len )
+        lengths.insert( it, len );
+    return idx;
+}
 
-        // Leave only one defined
-        //#define CONSERVATIVE
-        //#define NO_PROMOTIONS_FLAWED
-        #define CORRECT_BEST_PRACTICE
-        for( int i=0; i<nbr; i++ )
+void PositionStats::AddGame( const char *blob, int result, unsigned short offset_first, unsigned short offset_last )
+{
+    uint64_t hash = PathHash( blob, offset_first );
+    int idx = Find( blob, offset_first, hash );
+    if( idx < 0 )
+        idx = Insert( blob, offset_first, hash );
+    transpositions[idx].frequency++;
+    bool white_wins = (result==1);
+    if( white_wins )
+        total_white_wins++;
+    bool black_wins = (result==2);
+    if( black_wins )
+        total_black_wins++;
+    bool draw       = (result==3);
+    if( draw )
+        total_draws++;
+    char compressed_move = blob[offset_last];
+    if( compressed_move != '\0' ) // must be more moves
+    {
+        MOVE_STATS &ms = stats[compressed_move];    // new entries are zeroed
+        ms.nbr_games++;
+        if( white_wins )
+            ms.nbr_white_wins++;
+        else if( black_wins )
+            ms.nbr_black_wins++;
+        else if( draw )
+            ms.nbr_draws++;
+    }
+}
+
+void PositionStats::Merge( const PositionStats &other )
+{
+    total_white_wins += other.total_white_wins;
+    total_black_wins += other.total_black_wins;
+    total_draws      += other.total_draws;
+    for( const std::pair<const char,MOVE_STATS> &kv: other.stats )
+    {
+        MOVE_STATS &ms = stats[kv.first];
+        ms.nbr_games      += kv.second.nbr_games;
+        ms.nbr_white_wins += kv.second.nbr_white_wins;
+        ms.nbr_black_wins += kv.second.nbr_black_wins;
+        ms.nbr_draws      += kv.second.nbr_draws;
+    }
+    for( const PATH_TO_POSITION &ptp: other.transpositions )
+    {
+        const char *blob = ptp.blob.c_str();
+        size_t len = ptp.blob.length();
+        uint64_t hash = PathHash( blob, len );
+        int idx = Find( blob, len, hash );
+        if( idx < 0 )
+            idx = Insert( blob, len, hash );
+        transpositions[idx].frequency += ptp.frequency;
+    }
+}
+
+void PositionStats::Sort()
+{
+    // Ties in path order, so the result doesn't depend on how games were shared out
+    std::sort( transpositions.begin(), transpositions.end(),
+        []( const PATH_TO_POSITION &a, const PATH_TO_POSITION &b )
+        { return a.frequency!=b.frequency ? a.frequency>b.frequency : a.blob<b.blob; } );
+    index.clear();
+    for( size_t i=0; i<transpositions.size(); i++ )
+    {
+        const std::string &path = transpositions[i].blob;
+        index.insert( std::make_pair( PathHash(path.c_str(),path.length()), static_cast<int>(i) ) );
+    }
+}
+
+int PositionStats::FindTransposition( const char *blob, size_t &len ) const
+{
+    uint64_t hash = PATH_HASH_INIT;
+    size_t i = 0;
+    for( size_t path_len: lengths )
+    {
+        for( ; i<path_len; i++ )
         {
-            smart_ptr<ListableGame> p = (*source)[i];
-            const char *fen = p->Fen();
-            if( fen && *fen )
-                continue;   // a partial game in the clipboard
-            DoSearchFoundGame dsfg;
-            dsfg.idx = i;
-            dsfg.game_id = p->game_id;
-            dsfg.offset_first=0;
-            dsfg.offset_last=0;
-            /* Roster r = in_memory_game_cache[i]->RefRoster();
-            cprintf( "idx=%d, white=%s[%s], black=%s[%s], blob=%s\n",
-                        in_memory_game_cache[i]->game_id,
-                        in_memory_game_cache[i]->White(),  r.white.c_str(),
-                        in_memory_game_cache[i]->Black(),  r.black.c_str(),
-                        in_memory_game_cache[i]->CompressedMoves() ); */
-            bool promotion_in_game = p->TestPromotion();
-            bool game_found;
-            #ifdef CONSERVATIVE
-            game_found = SearchGameSlowPromotionAllowed( std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
-            #endif
-            #ifdef NO_PROMOTIONS_FLAWED
-            game_found = SearchGameOptimisedNoPromotionAllowed( std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
-            #endif
-            #ifdef CORRECT_BEST_PRACTICE
-            if( promotion_in_game )
-                game_found = SearchGameSlowPromotionAllowed( std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
-            else
-                game_found = SearchGameOptimisedNoPromotionAllowed( p->CompressedMoves(), dsfg.offset_first, dsfg.offset_last );
-            #endif
-            if( game_found )
-            {
-                games_found.push_back( dsfg );
-            }
-            if( (i&0xff)==0 && progress )
-                progress->Perfraction( i, nbr );
+            if( blob[i] == '\0' )
+                return -1;
+            hash = PathHashStep( hash, blob[i] );
+        }
+        int idx = Find( blob, path_len, hash );
+        if( idx >= 0 )
+        {
+            len = path_len;
+            return idx;
         }
     }
-    return games_found.size();
+    return -1;
 }
 
 int  MemoryPositionSearch::DoPatternSearch( PatternMatch &pm, ProgressBar *progress, PATTERN_STATS &stats )
@@ -517,7 +830,203 @@ int  MemoryPositionSearch::DoPatternSearch( PatternMatch &pm, ProgressBar *progr
     search_position = pm.parm.cp;
     search_position_set = true;
     search_source = source;
+    search_nbr_chunks = search_next_chunk = 0;     // pattern searches are always complete
+    position_stats_valid = false;
+    PatternSearchPrime( pm );
+    cprintf( "total_count_target=%d\n", ms.total_count_target );
+    const uint8_t *pass = FilterGames( source );
+    MpsSpanIndex *spans = SpanIndex( pm, source );
+    int nbr = source->size();
+    {
+        AutoTimer at("Search time");
+
+        // The games are searched in chunks, by this thread and for big enough searches
+        //  by worker threads too. MemoryPositionSearch and PatternMatch both keep per
+        //  game working state, so each worker gets its own (primed the same way). Each
+        //  chunk has its own found list and each thread its own stats, so the results
+        //  are the same, in the same order, however the chunks were shared out. Note
+        //  that each game is only read by one thread, but reading a game mustn't touch
+        //  shared state (eg ListableGamePgn games must already be loaded into memory)
+        int nbr_chunks = (nbr+MPS_SEARCH_CHUNK-1) / MPS_SEARCH_CHUNK;
+        int nbr_threads = nbr_threads_requested>0 ? nbr_threads_requested : std::thread::hardware_concurrency();
+        if( nbr_threads > nbr_chunks )
+            nbr_threads = nbr_chunks;
+        if( nbr_threads < 1 )
+            nbr_threads = 1;
+        std::vector< std::vector<DoSearchFoundGame> > chunks_found(nbr_chunks);
+        std::vector<PATTERN_STATS> threads_stats(nbr_threads);
+        std::atomic<int> next(0);
+        auto worker = [&]( MemoryPositionSearch &mps, PatternMatch &pm_thread, PATTERN_STATS &stats_thread, ProgressBar *progress_thread )
+        {
+            for(;;)
+            {
+                int idx = next++;
+                if( idx >= nbr_chunks )
+                    break;
+                int begin = idx*MPS_SEARCH_CHUNK;
+                int end   = std::min( begin+MPS_SEARCH_CHUNK, nbr );
+                mps.PatternSearchGames( pm_thread, source, begin, end, pass, spans, stats_thread, chunks_found[idx] );
+                if( progress_thread )
+                {
+                    double permill = (static_cast<double>(std::min(next.load(),nbr_chunks)) * 1000.0) / static_cast<double>(nbr_chunks);
+                    progress_thread->Permill( static_cast<int>(permill) );
+                }
+            }
+        };
+        std::vector<std::thread> pool;
+        for( int i=1; i<nbr_threads; i++ )
+        {
+            pool.push_back( std::thread( [&,i]()
+            {
+                MemoryPositionSearch mps;
+                PatternMatch pm_thread;
+                pm_thread.parm = pm.parm;
+                mps.PatternSearchPrime( pm_thread );
+                worker( mps, pm_thread, threads_stats[i], NULL );
+            } ) );
+        }
+        worker( *this, pm, threads_stats[0], progress );     // only this thread updates the progress bar
+        for( std::thread &t: pool )
+            t.join();
+        for( const PATTERN_STATS &s: threads_stats )
+            stats.Merge( s );
+        for( const std::vector<DoSearchFoundGame> &v: chunks_found )
+            games_found.insert( games_found.end(), v.begin(), v.end() );
+    }
+    return games_found.size();
+}
+
+int  MemoryPositionSearch::DoBatchSearch( const std::vector<thc::ChessPosition> &targets, ProgressBar *progress, std::vector<MpsBatchResult> &results, bool calculate_stats )
+{
+    return DoBatchSearch(targets,progress,results,&in_memory_game_cache,calculate_stats);
+}
+
+// Rather than priming a search for each target, replay each game once with
+//  CompressMoves::Hash64Batch() and look up the hash of every position in a table of
+//  target hashes. So the cost is nearly independent of the number of targets
+int  MemoryPositionSearch::DoBatchSearch( const std::vector<thc::ChessPosition> &targets, ProgressBar *progress, std::vector<MpsBatchResult> &results,
+                                          std::vector< smart_ptr<ListableGame> > *source, bool calculate_stats )
+{
+    AutoTimer at("Batch search time");
+    int nbr_targets = targets.size();
+    results.clear();
+    results.resize( nbr_targets );
+
+    // Duplicate targets share the results of the first of them, copied at the end
+    std::unordered_map<uint64_t,int> target_idx;
+    std::vector<int> same_as(nbr_targets);
+    for( int i=0; i<nbr_targets; i++ )
+    {
+        thc::ChessPosition temp = targets[i];     // Hash64Calculate() isn't const
+        uint64_t key = Hash64Key( temp.Hash64Calculate(), temp.white );
+        auto it = target_idx.find(key);
+        if( it == target_idx.end() )
+            it = target_idx.insert( std::make_pair(key,i) ).first;
+        same_as[i] = it->second;
+    }
+    const uint8_t *pass = FilterGames( source );
+    int nbr = source->size();
+
+    // Shared out to threads in chunks as for DoPatternSearch() above. Each chunk has a
+    //  list of (target,game) pairs found, each thread its own stats for every target
+    int nbr_chunks = (nbr+MPS_SEARCH_CHUNK-1) / MPS_SEARCH_CHUNK;
+    int nbr_threads = nbr_threads_requested>0 ? nbr_threads_requested : std::thread::hardware_concurrency();
+    if( nbr_threads > nbr_chunks )
+        nbr_threads = nbr_chunks;
+    if( nbr_threads < 1 )
+        nbr_threads = 1;
+    std::vector< std::vector< std::pair<int,DoSearchFoundGame> > > chunks_found(nbr_chunks);
+    std::vector< std::vector<PositionStats> > threads_stats(nbr_threads);
+    if( calculate_stats )
+    {
+        for( std::vector<PositionStats> &v: threads_stats )
+            v.resize( nbr_targets );
+    }
+    std::atomic<int> next(0);
+    auto worker = [&]( std::vector<PositionStats> &stats_thread, ProgressBar *progress_thread )
+    {
+        CompressMoves press;
+        std::vector<uint64_t> hashes;
+        std::vector<int> last_game(nbr_targets,-1);     // so only a target's first occurrence in a game counts
+        for(;;)
+        {
+            int idx = next++;
+            if( idx >= nbr_chunks )
+                break;
+            int begin = idx*MPS_SEARCH_CHUNK;
+            int end   = std::min( begin+MPS_SEARCH_CHUNK, nbr );
+            std::vector< std::pair<int,DoSearchFoundGame> > &found = chunks_found[idx];
+            for( int i=begin; i<end; i++ )
+            {
+                if( pass && !pass[i] )
+                    continue;
+                const smart_ptr<ListableGame> &p = (*source)[i];
+                const char *fen = p->Fen();
+                if( fen && *fen )
+                    continue;   // a partial game in the clipboard
+                const char *blob = p->CompressedMoves();
+                size_t len = strlen(blob);
+                if( len > 0xffff )
+                    len = 0xffff;   // offsets are unsigned short
+                thc::ChessPosition start;
+                press.Hash64Batch( start, blob, len, hashes );
+                for( size_t ply=0; ply<hashes.size(); ply++ )
+                {
+                    auto it = target_idx.find( Hash64Key(hashes[ply],ply%2==0) );
+                    if( it==target_idx.end() || last_game[it->second]==i )
+                        continue;
+                    last_game[it->second] = i;
+                    DoSearchFoundGame dsfg;
+                    dsfg.idx = i;
+                    dsfg.game_id = p->game_id;
+                    dsfg.offset_first = dsfg.offset_last = static_cast<unsigned short>(ply);
+                    found.push_back( std::make_pair(it->second,dsfg) );
+                    if( calculate_stats )
+                        stats_thread[it->second].AddGame( blob, p->ResultBin(), dsfg.offset_first, dsfg.offset_last );
+                }
+            }
+            if( progress_thread )
+                progress_thread->Perfraction( std::min(next.load(),nbr_chunks), nbr_chunks );
+        }
+    };
+    std::vector<std::thread> pool;
+    for( int i=1; i<nbr_threads; i++ )
+        pool.push_back( std::thread( [&,i]() { worker( threads_stats[i], NULL ); } ) );
+    worker( threads_stats[0], progress );     // only this thread updates the progress bar
+    for( std::thread &t: pool )
+        t.join();
+    int total = 0;
+    for( const std::vector< std::pair<int,DoSearchFoundGame> > &v: chunks_found )
+    {
+        for( const std::pair<int,DoSearchFoundGame> &f: v )
+            results[f.first].games_found.push_back( f.second );
+        total += v.size();
+    }
+    if( calculate_stats )
+    {
+        for( int i=0; i<nbr_targets; i++ )
+        {
+            if( same_as[i] != i )
+                continue;
+            for( const std::vector<PositionStats> &v: threads_stats )
+                results[i].stats.Merge( v[i] );
+            results[i].stats.Sort();
+        }
+    }
+    for( int i=0; i<nbr_targets; i++ )
+    {
+        if( same_as[i] != i )
+        {
+            results[i] = results[same_as[i]];
+            total += results[i].games_found.size();
+        }
+    }
+    return total;
+}
 
+// Set up the target position and pattern mask for DoPatternSearch()
+void MemoryPositionSearch::PatternSearchPrime( PatternMatch &pm )
+{
     // Set up counts of total pieces, and individual pieces in the target position
     ms.total_count_target = 64;     // reverse count non-pieces from 64
     ms.black_count_target = 0;
@@ -637,7 +1146,6 @@ int  MemoryPositionSearch::DoPatternSearch( PatternMatch &pm, ProgressBar *progr
         mq.target_squares[i] = piece;
         ms.slow_target_squares[i] = piece;
     }
-    cprintf( "total_count_target=%d\n", ms.total_count_target );
 
     // Set up white_home_mask and white_home_pawns to support the following logic;
     //  bool home_pawns_still_in_place = ((white_home_mask&*mq.rank2_ptr) == white_home_pawns );
@@ -679,6 +1187,11 @@ int  MemoryPositionSearch::DoPatternSearch( PatternMatch &pm, ProgressBar *progr
         }
     }
 
+    // Pawn structure searches, the pieces don't matter (for games without a pawn
+    //  structure index, see PatternSearchGames())
+    if( pm.parm.pawn_structure && !pm.parm.material_balance )
+        ms.total_count_target = ms.white_pawn_count_target + ms.black_pawn_count_target;
+
     // Set up the pattern mask
     pm.Prime(&msi.cr);
     mq.rank3_target = *mq.rank3_target_ptr;
@@ -689,171 +1202,291 @@ int  MemoryPositionSearch::DoPatternSearch( PatternMatch &pm, ProgressBar *progr
     mq.rank8_target = *mq.rank8_target_ptr;
     mq.rank1_target = *mq.rank1_target_ptr;
     mq.rank2_target = *mq.rank2_target_ptr;
-    int nbr = source->size();
+}
+
+// The span index for a pattern search of the source, sized for the source and kept from
+//  earlier searches if the source hasn't changed. NULL if the search doesn't use one
+MpsSpanIndex *MemoryPositionSearch::SpanIndex( PatternMatch &pm, std::vector< smart_ptr<ListableGame> > *source )
+{
+    if( !pm.parm.material_balance && !pm.parm.pawn_structure )
+        return NULL;
+    size_t nbr = source->size();
+    if( nbr == 0 )
+        return NULL;
+    if( span_index.source!=source || span_index.nbr_games!=nbr ||
+        span_index.first_game_id!=(*source)[0]->game_id || span_index.last_game_id!=(*source)[nbr-1]->game_id )
     {
-        AutoTimer at("Search time");
-        #ifdef TEMP_EXPERIMENT
-        thc::MOVELIST list;
+        span_index.Clear();
+        span_index.source = source;
+        span_index.nbr_games = nbr;
+        span_index.first_game_id = (*source)[0]->game_id;
+        span_index.last_game_id  = (*source)[nbr-1]->game_id;
+        span_index.chunks.resize( (nbr+MPS_SEARCH_CHUNK-1) / MPS_SEARCH_CHUNK );
+    }
+    return &span_index;
+}
+
+// Build the material signature index of a chunk of games begin to end-1, unless it's built already
+static void BuildMaterialSpans( MpsSpanChunk &chunk, std::vector< smart_ptr<ListableGame> > *source, int begin, int end )
+{
+    if( chunk.material_built )
+        return;
+    std::vector<MaterialSpan> spans;
+    chunk.material.clear();
+    chunk.material_offsets.resize( end-begin+1 );
+    for( int i=begin; i<end; i++ )
+    {
+        chunk.material_offsets[i-begin] = static_cast<uint32_t>( chunk.material.size() );
+        ListableGame *p = (*source)[i].get();
+        if( p->IsGameDocument() )
+            continue;
+        const char *blob = p->CompressedMoves();
+        CompressMoves press;
+        press.MaterialSpans( blob, strlen(blob), spans );
+        chunk.material.insert( chunk.material.end(), spans.begin(), spans.end() );
+    }
+    chunk.material_offsets[end-begin] = static_cast<uint32_t>( chunk.material.size() );
+    chunk.material_built = true;
+}
+
+// Build the pawn structure index of a chunk of games begin to end-1, unless it's built already
+static void BuildPawnSpans( MpsSpanChunk &chunk, std::vector< smart_ptr<ListableGame> > *source, int begin, int end )
+{
+    if( chunk.pawn_built )
+        return;
+    std::vector<PawnSpan> spans;
+    chunk.pawn.clear();
+    chunk.pawn_offsets.resize( end-begin+1 );
+    for( int i=begin; i<end; i++ )
+    {
+        chunk.pawn_offsets[i-begin] = static_cast<uint32_t>( chunk.pawn.size() );
+        ListableGame *p = (*source)[i].get();
+        if( p->IsGameDocument() )
+            continue;
+        const char *blob = p->CompressedMoves();
+        CompressMoves press;
+        press.PawnSpans( blob, strlen(blob), spans );
+        chunk.pawn.insert( chunk.pawn.end(), spans.begin(), spans.end() );
+    }
+    chunk.pawn_offsets[end-begin] = static_cast<uint32_t>( chunk.pawn.size() );
+    chunk.pawn_built = true;
+}
+
+// Pattern search games begin to end-1 of the source, appending any found to found,
+//  skipping games without a pass flag (if there are pass flags). begin is the start
+//  of a chunk, so that the chunk's part of the span index (if any) can be used
+void MemoryPositionSearch::PatternSearchGames( PatternMatch &pm, std::vector< smart_ptr<ListableGame> > *source, int begin, int end, const uint8_t *pass,
+                                               MpsSpanIndex *spans, PATTERN_STATS &stats, std::vector<DoSearchFoundGame> &found )
+{
+    #ifdef TEMP_EXPERIMENT
+    thc::MOVELIST list;
+    #endif
+    MpsSpanChunk *chunk = NULL;
+    if( spans )
+    {
+        chunk = &spans->chunks[begin/MPS_SEARCH_CHUNK];
+        if( pm.parm.material_balance )
+            BuildMaterialSpans( *chunk, source, begin, end );
+        else
+            BuildPawnSpans( *chunk, source, begin, end );
+    }
+    for( int i=begin; i<end; i++ )
+    {
+        if( pass && !pass[i] )
+            continue;
+        const smart_ptr<ListableGame> &p = (*source)[i];
+
+
+        // TEMP TEMP - Find unconverted instances of the "ULTIMATE BLUNDER" players
+        //   consecutively miss mate in one opportunities
+        #ifdef ULTIMATE_BLUNDER1
+        thc::ChessRules cr;
+        CompressMoves comp;
+        std::string comp_moves = std::string(p->CompressedMoves());
+        std::vector<thc::Move> v = comp.Uncompress(cr,comp_moves);
+        int prev = -1;
+        bool game_found = false;
+        for( int k=0; k<v.size(); k++ )
+        {
+            thc::Move mv = v[k];
+            cr.PushMove(mv);
+            cr.GenLegalMoveList( &list );
+            for( int j=0; j<list.count; j++ )
+            {
+                cr.PushMove(list.moves[j]);
+                thc::TERMINAL score;
+                cr.Evaluate(score);
+                cr.PopMove(list.moves[j]);
+                if( score==thc::TERMINAL_WCHECKMATE || score==thc::TERMINAL_BCHECKMATE )
+                {
+                    if( prev!=-1 && prev+1==k )
+                    {
+                        game_found = true;
+                        break;
+                    }
+                    prev = k;
+                }
+            }
+        }
+        if( game_found )
+        {
+            DoSearchFoundGame dsfg;
+            dsfg.idx = i;
+            dsfg.game_id = p->game_id;
+            dsfg.offset_first=prev;
+            dsfg.offset_last=prev+1;
+            stats.nbr_games++;
+            int result = p->ResultBin();
+            if( result == 1 )
+                stats.white_wins++;
+            else if( result == 2 )
+                stats.black_wins++;
+            else
+                stats.draws++;
+            found.push_back( dsfg );
+        }
         #endif
-        for( int i=0; i<nbr; i++ )
-        {
-            smart_ptr<ListableGame> p = (*source)[i];
-
-            // TEMP TEMP - Find unconverted instances of the "ULTIMATE BLUNDER" players
-            //   consecutively miss mate in one opportunities
-            #ifdef ULTIMATE_BLUNDER1
-            thc::ChessRules cr;
-            CompressMoves comp;
-            std::string comp_moves = std::string(p->CompressedMoves());
-            std::vector<thc::Move> v = comp.Uncompress(cr,comp_moves);
-            int prev = -1;
-            bool game_found = false;
-            for( int k=0; k<v.size(); k++ )
-            {
-                thc::Move mv = v[k];
-                cr.PushMove(mv);
+        // TEMP TEMP - Find instances of the "ULTIMATE BLUNDER" - the game ends in mate
+        //   the other side could have mated though with their last move
+        #ifdef ULTIMATE_BLUNDER2
+        thc::ChessRules cr;
+        CompressMoves comp;
+        std::string comp_moves = std::string(p->CompressedMoves());
+        std::vector<thc::Move> v = comp.Uncompress(cr,comp_moves);
+        for( thc::Move mv: v )
+            cr.PushMove(mv);
+        //cprintf( "Final position is %s\n", cr.ToDebugStr().c_str() );
+        thc::TERMINAL score, find;
+        bool ok = cr.Evaluate(score);
+        bool game_found = false;
+        size_t len = v.size();
+        if( ok && (score == thc::TERMINAL_BCHECKMATE || score == thc::TERMINAL_WCHECKMATE) )
+        {
+            if( score == thc::TERMINAL_BCHECKMATE )
+                find = thc::TERMINAL_WCHECKMATE;
+            else
+                find = thc::TERMINAL_BCHECKMATE;
+            if( len >= 2 )
+            {
+                cr.PopMove(v[len-1]);
+                cr.PopMove(v[len-2]);
                 cr.GenLegalMoveList( &list );
                 for( int j=0; j<list.count; j++ )
                 {
                     cr.PushMove(list.moves[j]);
-                    thc::TERMINAL score;
-                    cr.Evaluate(score);
+                    thc::TERMINAL score2;
+                    ok = cr.Evaluate(score2);
                     cr.PopMove(list.moves[j]);
-                    if( score==thc::TERMINAL_WCHECKMATE || score==thc::TERMINAL_BCHECKMATE )
-                    {
-                        if( prev!=-1 && prev+1==k )
-                        {
-                            game_found = true;
-                            break;
-                        }
-                        prev = k;
-                    }
+                    if( ok && score2==find )
+                        game_found = true;
                 }
             }
-            if( game_found )
+        }
+        if( game_found )
+        {
+            DoSearchFoundGame dsfg;
+            dsfg.idx = i;
+            dsfg.game_id = p->game_id;
+            dsfg.offset_first=0;
+            dsfg.offset_last=len-2;
+            stats.nbr_games++;
+            int result = p->ResultBin();
+            if( result == 1 )
+                stats.white_wins++;
+            else if( result == 2 )
+                stats.black_wins++;
+            else
+                stats.draws++;
+            found.push_back( dsfg );
+        }
+        #endif
+        #ifndef TEMP_EXPERIMENT
+        //if( 0 == strcmp(p->White(),"Gu, Xiaobing") &&  0 == strcmp(p->Black(),"Ryjanova, Julia")  )
+        //    debug_trigger = true;
+        DoSearchFoundGame dsfg;
+        dsfg.idx = i;
+        dsfg.game_id = p->game_id;
+        dsfg.offset_first=0;
+        dsfg.offset_last=0;
+
+        // For material balance searches, use the game's material signature index to skip
+        //  it altogether, or at least to only test plies where the material might match
+        if( pm.parm.material_balance && !p->IsGameDocument() )
+        {
+            const MaterialSpan *first = chunk->material.data() + chunk->material_offsets[i-begin];
+            const MaterialSpan *last  = chunk->material.data() + chunk->material_offsets[i-begin+1];
+            unsigned short first_ply = 0xffff;
+            unsigned short last_ply  = 0;
+            for( const MaterialSpan *span=first; span<last; span++ )
             {
-                DoSearchFoundGame dsfg;
-                dsfg.idx = i;
-                dsfg.game_id = p->game_id;
-                dsfg.offset_first=prev;
-                dsfg.offset_last=prev+1;
-                stats.nbr_games++;
-                if( 0 == strcmp(p->Result(),"1-0") )
-                    stats.white_wins++;
-                else if( 0 == strcmp(p->Result(),"0-1") )
-                    stats.black_wins++;
-                else
-                    stats.draws++;
-                games_found.push_back( dsfg );
-            }
-            #endif
-            // TEMP TEMP - Find instances of the "ULTIMATE BLUNDER" - the game ends in mate
-            //   the other side could have mated though with their last move
-            #ifdef ULTIMATE_BLUNDER2
-            thc::ChessRules cr;
-            CompressMoves comp;
-            std::string comp_moves = std::string(p->CompressedMoves());
-            std::vector<thc::Move> v = comp.Uncompress(cr,comp_moves);
-            for( thc::Move mv: v )
-                cr.PushMove(mv);
-            //cprintf( "Final position is %s\n", cr.ToDebugStr().c_str() );
-            thc::TERMINAL score, find;
-            bool ok = cr.Evaluate(score);
-            bool game_found = false;
-            size_t len = v.size();
-            if( ok && (score == thc::TERMINAL_BCHECKMATE || score == thc::TERMINAL_WCHECKMATE) )
-            {
-                if( score == thc::TERMINAL_BCHECKMATE )
-                    find = thc::TERMINAL_WCHECKMATE;
-                else
-                    find = thc::TERMINAL_BCHECKMATE;
-                if( len >= 2 )
+                if( pm.MaterialSignaturePossible(span->signature) )
                 {
-                    cr.PopMove(v[len-1]);
-                    cr.PopMove(v[len-2]);
-                    cr.GenLegalMoveList( &list );
-                    for( int j=0; j<list.count; j++ )
-                    {
-                        cr.PushMove(list.moves[j]);
-                        thc::TERMINAL score2;
-                        ok = cr.Evaluate(score2);
-                        cr.PopMove(list.moves[j]);
-                        if( ok && score2==find )
-                            game_found = true;
-                    }
+                    if( span->first_ply < first_ply )
+                        first_ply = span->first_ply;
+                    last_ply = span->last_ply;
                 }
             }
-            if( game_found )
+            if( first_ply > last_ply )
+                continue;
+            pattern_first_ply = first_ply;
+            pattern_last_ply  = last_ply;
+        }
+        bool promotion_in_game = p->TestPromotion();
+        bool game_found=false, reverse=false;
+        pm.NewGame();
+
+        // Pawn structure searches only need the game's pawn structure index (GameDocuments
+        //  have none, they're tested ply by ply below)
+        if( pm.parm.pawn_structure && !pm.parm.material_balance && !p->IsGameDocument() )
+        {
+            const PawnSpan *first = chunk->pawn.data() + chunk->pawn_offsets[i-begin];
+            const PawnSpan *last  = chunk->pawn.data() + chunk->pawn_offsets[i-begin+1];
+            for( const PawnSpan *span=first; !game_found && span<last; span++ )
+                game_found = pm.TestPawnSpan( reverse, *span, dsfg.offset_first );
+            dsfg.offset_last = dsfg.offset_first;
+        }
+        else if( promotion_in_game )
+            game_found = PatternSearchGameSlowPromotionAllowed( pm, reverse, std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
+        else
+            game_found = PatternSearchGameOptimisedNoPromotionAllowed( pm, reverse, p->CompressedMoves(), dsfg.offset_first, dsfg.offset_last );
+        pattern_first_ply = 0;
+        pattern_last_ply  = 0xffff;
+        if( game_found )
+        {
+            stats.nbr_games++;
+
+            // ResultBin() (1=1-0, 2=0-1) rather than Result(), which isn't thread safe for
+            //  database games (it formats into a shared pool of strings)
+            int result = p->ResultBin();
+            if( reverse )
             {
-                DoSearchFoundGame dsfg;
-                dsfg.idx = i;
-                dsfg.game_id = p->game_id;
-                dsfg.offset_first=0;
-                dsfg.offset_last=len-2;
-                stats.nbr_games++;
-                if( 0 == strcmp(p->Result(),"1-0") )
-                    stats.white_wins++;
-                else if( 0 == strcmp(p->Result(),"0-1") )
+                stats.nbr_reversed_games++;
+                if( result == 1 )
                     stats.black_wins++;
+                else if( result == 2 )
+                    stats.white_wins++;
                 else
                     stats.draws++;
-                games_found.push_back( dsfg );
             }
-            #endif
-            #ifndef TEMP_EXPERIMENT
-            //if( 0 == strcmp(p->White(),"Gu, Xiaobing") &&  0 == strcmp(p->Black(),"Ryjanova, Julia")  )
-            //    debug_trigger = true;
-            DoSearchFoundGame dsfg;
-            dsfg.idx = i;
-            dsfg.game_id = p->game_id;
-            dsfg.offset_first=0;
-            dsfg.offset_last=0;
-            bool promotion_in_game = p->TestPromotion();
-            bool game_found, reverse;
-            pm.NewGame();
-            if( promotion_in_game )
-                game_found = PatternSearchGameSlowPromotionAllowed( pm, reverse, std::string(p->CompressedMoves()), dsfg.offset_first, dsfg.offset_last  );
             else
-                game_found = PatternSearchGameOptimisedNoPromotionAllowed( pm, reverse, p->CompressedMoves(), dsfg.offset_first, dsfg.offset_last );
-            if( game_found )
             {
-                stats.nbr_games++;
-                if( reverse )
-                {
-                    stats.nbr_reversed_games++;
-                    if( 0 == strcmp(p->Result(),"1-0") )
-                        stats.black_wins++;
-                    else if( 0 == strcmp(p->Result(),"0-1") )
-                        stats.white_wins++;
-                    else
-                        stats.draws++;
-                }
+                if( result == 1 )
+                    stats.white_wins++;
+                else if( result == 2 )
+                    stats.black_wins++;
                 else
-                {
-                    if( 0 == strcmp(p->Result(),"1-0") )
-                        stats.white_wins++;
-                    else if( 0 == strcmp(p->Result(),"0-1") )
-                        stats.black_wins++;
-                    else
-                        stats.draws++;
-                }
-                games_found.push_back( dsfg );
-            }
-            #endif
-            if( (i&0xff)==0 && progress )
-            {
-                double permill = (static_cast<double>(i) * 1000.0) / static_cast<double>(nbr);
-                progress->Permill( static_cast<int>(permill) );
+                    stats.draws++;
             }
+            found.push_back( dsfg );
         }
+        #endif
     }
-    return games_found.size();
 }
 
 thc::Move MemoryPositionSearch::UncompressSlowMode( char code )
 {
     // Horrible kludge necessitated by our 'd'/'D' = dark bishops stuff
-    thc::ChessRules temp = msi.cr;
+    thc::ChessPosition temp = msi.cr;  // just the position, not msi.cr's move history
     for( int i=0; i<64; i++ )
     {
         char c = msi.cr.squares[i];
@@ -869,29 +1502,22 @@ thc::Move MemoryPositionSearch::UncompressSlowMode( char code )
     temp.bking = 1;
     temp.bqueen = 1;
 
-    // Generate a list of all legal moves, in string form, sorted
-    std::vector<thc::Move> moves;
-    temp.GenLegalMoveList( moves );
-    std::vector<std::string> moves_alpha;
+    // Generate a list of all legal moves, sorted as their TerseOut() strings would be
+    thc::Move moves[MAXMOVES];
+    int len = SlowModeMoveList( temp, moves );
 
     // Coding scheme relies on 254 valid codes 0x02-0xff and one error code 0x01,
-    size_t len = moves.size();
-    for( size_t i=0; i<len; i++ )
-    {
-        std::string s = moves[i].TerseOut();
-        moves_alpha.push_back(s);
-    }
-    std::sort( moves_alpha.begin(), moves_alpha.end() );
-
     // '\xff' (i.e. 255) is first move in list, '\fe' (i.e. 254) is second etc
     unsigned int ucode = static_cast<size_t>( code );
     ucode &= 0xff;
-    size_t idx = 255-ucode;  // 255->0, 254->1 etc.
+    int idx = 255-ucode;  // 255->0, 254->1 etc.
     if( idx >= len )
         idx = 0;    // all errors resolve to this - take first move from list
-    std::string the_move = moves_alpha[idx];
     thc::Move mv;
-    mv.TerseIn( &temp, the_move.c_str() );
+    if( len == 0 )
+        mv.Invalid();
+    else
+        mv = moves[idx];
     return mv;
 }
 
@@ -907,22 +1533,11 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
         {
             special = thc::SPECIAL_KING_MOVE;
             src = side->king;
-            int delta=0;
-            switch( code&0x0f )     // 0, 1, 2
-            {                       // 8, 9, 10
-                                    // 16,17,18
-                case K_VECTOR_NW:    delta = -9; break;  // 0-9
-                case K_VECTOR_N:     delta = -8; break;  // 1-9
-                case K_VECTOR_NE:    delta = -7; break;  // 2-9
-                case K_VECTOR_W:     delta = -1; break;  // 8-9
-                case K_VECTOR_E:     delta =  1; break;  // 10-9
-                case K_VECTOR_SW:    delta =  7; break;  // 16-9
-                case K_VECTOR_S:     delta =  8; break;  // 17-9
-                case K_VECTOR_SE:    delta =  9; break;  // 18-9
+            switch( code&0x0f )
+            {
                 case K_K_CASTLING:
                 {
                     special = msi.cr.white ? thc::SPECIAL_WK_CASTLING : thc::SPECIAL_BK_CASTLING;
-                    delta = 2;
                     int rook_offset = (side->rooks[0]==src+3 ? 0 : 1);  // a rook will be 3 squares to right of king
                     side->rooks[rook_offset] = src+1;                   // that rook ends up 1 square right of king
                     // note that there is no way the rooks ordering can swap during castling
@@ -931,14 +1546,13 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
                 case K_Q_CASTLING:
                 {
                     special = msi.cr.white ? thc::SPECIAL_WQ_CASTLING : thc::SPECIAL_BQ_CASTLING;
-                    delta = -2;
                     int rook_offset = (side->rooks[0]==src-4 ? 0 : 1);  // a rook will be 4 squares to left of king
                     side->rooks[rook_offset] = src-1;                   // that rook ends up 1 square left of king
                     // note that there is no way the rooks ordering can swap during castling
                     break;
                 }
             }
-            side->king = dst = src+delta;
+            side->king = dst = fast_king_dst[code&0x0f][src];
             break;
         }
 
@@ -947,14 +1561,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
         {
             int rook_offset = (hi_nibble==CODE_ROOK_LO ? 0 : 1 );
             src = side->rooks[rook_offset];
-            if( code & R_RANK )                // code encodes rank ?
-            {
-                dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-            }
-            else
-            {
-                dst = (src&0x38) | (code&7);        // same rank as src, file from code
-            }
+            dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
             side->rooks[rook_offset] = dst;
 
             // swap ?
@@ -970,11 +1577,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
         case CODE_BISHOP_DARK:
         {
             src = side->bishop_dark;
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=b8(1), dst=h2(55), file_delta=6  -> 9*6 =54
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->bishop_dark = dst;
             break;
         }
@@ -982,11 +1585,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
         case CODE_BISHOP_LIGHT:
         {
             src = side->bishop_light;
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=g8(6), dst=a2(48), file_delta=6  -> 7*6 =42
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->bishop_light = dst;
             break;
         }
@@ -994,10 +1593,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
         case CODE_QUEEN_ROOK:
         {
             src = side->queens[0];
-            if( code & R_RANK )                // code encodes rank ?
-                dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-            else
-                dst = (src&0x38) | (code&7);        // same rank as src, file from code
+            dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
             side->queens[0] = dst;
 
             // swap ?
@@ -1013,11 +1609,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
         case CODE_QUEEN_BISHOP:
         {
             src = side->queens[0];
-            int file_delta = (code&7) - (src&7);
-            if( code & B_FALL )  // FALL\ + file
-                dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-            else                  // RISE/ + file
-                dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+            dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
             side->queens[0] = dst;
 
             // swap ?
@@ -1034,21 +1626,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
         {
             int knight_offset = ((code&N_HI) ? 1 : 0 );;
             src = side->knights[knight_offset];
-            int delta=0;
-            switch(code&7)          // 0, 1, 2, 3
-            {                       // 8, 9, 10,11
-                                    // 16,17,18,19
-                                    // 24,25,26,27
-                case N_VECTOR_NNE:   delta = -15;   break; // 2-17
-                case N_VECTOR_NEE:   delta = -6;    break; // 11-17
-                case N_VECTOR_SEE:   delta = 10;    break; // 27-17
-                case N_VECTOR_SSE:   delta = 17;    break; // 27-10
-                case N_VECTOR_SSW:   delta = 15;    break; // 25-10
-                case N_VECTOR_SWW:   delta = 6;     break; // 16-10
-                case N_VECTOR_NWW:   delta = -10;   break; // 0-10
-                case N_VECTOR_NNW:   delta = -17;   break; // 0-17
-            }
-            dst = src+delta;
+            dst = fast_knight_dst[code&0x0f][src];
             side->knights[knight_offset] = dst;
 
             // swap ?
@@ -1068,10 +1646,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
             else
             {
                 src = side->queens[1];
-                if( code & R_RANK )                // code encodes rank ?
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                else
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 side->queens[1] = dst;
 
                 // swap ?
@@ -1092,11 +1667,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
             else
             {
                 src = side->queens[1];
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 side->queens[1] = dst;
 
                 // swap ?
@@ -1118,37 +1689,28 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
             src = side->pawns[pawn_offset];
             bool reordering_possible = false;
             bool white = msi.cr.white;
-            int delta=0;
+            dst = fast_pawn_dst[white?0:1][code&0x0f][src];
             switch( code&0x0f )
             {
-                case P_DOUBLE:      special = white ? thc::SPECIAL_WPAWN_2SQUARES : thc::SPECIAL_BPAWN_2SQUARES;
-                                    delta = white?-16:16; break;
-                case P_SINGLE:      delta = white?-8:8;   break;
+                case P_DOUBLE:      special = white ? thc::SPECIAL_WPAWN_2SQUARES : thc::SPECIAL_BPAWN_2SQUARES; break;
+                case P_SINGLE:      break;
                 case P_LEFT:
                 {
                     reordering_possible = true;
-                    delta = white?-9:9;
-                    if( !isalpha(msi.cr.squares[src+delta]) )
+                    if( !isalpha(msi.cr.squares[dst]) )
                         special = (white ? thc::SPECIAL_WEN_PASSANT : thc::SPECIAL_BEN_PASSANT);
                     break;
                 }
                 case P_RIGHT:
                 {
                     reordering_possible = true;
-                    delta = white?-7:7;
-                    if( !isalpha(msi.cr.squares[src+delta]) )
+                    if( !isalpha(msi.cr.squares[dst]) )
                         special = (white ? thc::SPECIAL_WEN_PASSANT : thc::SPECIAL_BEN_PASSANT);
                     break;
                 }
                 default:
                 {
                     promoting = true;
-                    switch( (code>>2)&3 )
-                    {
-                        case P_SINGLE:     delta = white?-8:8;   break;
-                        case P_LEFT:       delta = white?-9:9;   break;
-                        case P_RIGHT:      delta = white?-7:7;   break;
-                    }
                     switch( code&3 )
                     {
                         case P_QUEEN:      special = thc::SPECIAL_PROMOTION_QUEEN;    break;
@@ -1159,7 +1721,7 @@ thc::Move MemoryPositionSearch::UncompressFastMode( char code, MpsSide *side, Mp
                     break;
                 }
             }
-            side->pawns[pawn_offset] = dst = src+delta;
+            side->pawns[pawn_offset] = dst;
 
             // If promoting piece, force a reset and retry next time for this side. This
             //  way we accommodate our pawn disappearing, and a new piece appearing in
@@ -1318,23 +1880,12 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_KING:
             {
                 src = mqi.side_white.king;
-                int delta=0;
-                switch( code&0x0f )     // 0, 1, 2
-                {                       // 8, 9, 10
-                                        // 16,17,18
+                switch( code&0x0f )
+                {
                     case 0: return false;   // CODE_KING = 0, so '\0' string terminator
-                    case K_VECTOR_NW:    delta = -9; break;  // 0-9
-                    case K_VECTOR_N:     delta = -8; break;  // 1-9
-                    case K_VECTOR_NE:    delta = -7; break;  // 2-9
-                    case K_VECTOR_W:     delta = -1; break;  // 8-9
-                    case K_VECTOR_E:     delta =  1; break;  // 10-9
-                    case K_VECTOR_SW:    delta =  7; break;  // 16-9
-                    case K_VECTOR_S:     delta =  8; break;  // 17-9
-                    case K_VECTOR_SE:    delta =  9; break;  // 18-9
                     case K_K_CASTLING:
                     {
                         // Idea: replace this with a single 32 bit ptr store of ' RK '
-                        delta = 2;
                         int rook_offset = (mqi.side_white.rooks[0]==src+3 ? 0 : 1);  // a rook will be 3 squares to right of king
                         mqi.side_white.rooks[rook_offset] = src+1;                   // that rook ends up 1 square right of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -1344,7 +1895,6 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
                     }
                     case K_Q_CASTLING:
                     {
-                        delta = -2;
                         int rook_offset = (mqi.side_white.rooks[0]==src-4 ? 0 : 1);  // a rook will be 4 squares to left of king
                         mqi.side_white.rooks[rook_offset] = src-1;                   // that rook ends up 1 square left of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -1353,7 +1903,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
                         break;
                     }
                 }
-                mqi.side_white.king = dst = src+delta;
+                mqi.side_white.king = dst = fast_king_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'K';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1365,14 +1915,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             {
                 int rook_offset = (hi_nibble==CODE_ROOK_LO ? 0 : 1 );
                 src = mqi.side_white.rooks[rook_offset];
-                if( code & R_RANK )                // code encodes rank ?
-                {
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                }
-                else
-                {
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
-                }
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 mqi.side_white.rooks[rook_offset] = dst;
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'R';
@@ -1391,11 +1934,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_BISHOP_DARK:
             {
                 src = mqi.side_white.bishop_dark;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=b8(1), dst=h2(55), file_delta=6  -> 9*6 =54
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'D';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1406,11 +1945,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_BISHOP_LIGHT:
             {
                 src = mqi.side_white.bishop_light;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=g8(6), dst=a2(48), file_delta=6  -> 7*6 =42
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'B';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1421,10 +1956,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_QUEEN_ROOK:
             {
                 src = mqi.side_white.queens[0];
-                if( code & R_RANK )                // code encodes rank ?
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                else
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'Q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1435,11 +1967,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_QUEEN_BISHOP:
             {
                 src = mqi.side_white.queens[0];
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'Q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1451,21 +1979,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             {
                 int knight_offset = ((code&N_HI) ? 1 : 0 );
                 src = mqi.side_white.knights[knight_offset];
-                int delta=0;
-                switch(code&7)          // 0, 1, 2, 3
-                {                       // 8, 9, 10,11
-                                        // 16,17,18,19
-                                        // 24,25,26,27
-                    case N_VECTOR_NNE:   delta = -15;   break; // 2-17
-                    case N_VECTOR_NEE:   delta = -6;    break; // 11-17
-                    case N_VECTOR_SEE:   delta = 10;    break; // 27-17
-                    case N_VECTOR_SSE:   delta = 17;    break; // 27-10
-                    case N_VECTOR_SSW:   delta = 15;    break; // 25-10
-                    case N_VECTOR_SWW:   delta = 6;     break; // 16-10
-                    case N_VECTOR_NWW:   delta = -10;   break; // 0-10
-                    case N_VECTOR_NNW:   delta = -17;   break; // 0-17
-                }
-                dst = src+delta;
+                dst = fast_knight_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'N';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1671,22 +2185,11 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_KING:
             {
                 src = mqi.side_black.king;
-                int delta=0;
-                switch( code&0x0f )     // 0, 1, 2
-                {                       // 8, 9, 10
-                                        // 16,17,18
+                switch( code&0x0f )
+                {
                     case 0: return false;   // CODE_KING = 0, so '\0' string terminator
-                    case K_VECTOR_NW:    delta = -9; break;  // 0-9
-                    case K_VECTOR_N:     delta = -8; break;  // 1-9
-                    case K_VECTOR_NE:    delta = -7; break;  // 2-9
-                    case K_VECTOR_W:     delta = -1; break;  // 8-9
-                    case K_VECTOR_E:     delta =  1; break;  // 10-9
-                    case K_VECTOR_SW:    delta =  7; break;  // 16-9
-                    case K_VECTOR_S:     delta =  8; break;  // 17-9
-                    case K_VECTOR_SE:    delta =  9; break;  // 18-9
                     case K_K_CASTLING:
                     {
-                        delta = 2;
                         int rook_offset = (mqi.side_black.rooks[0]==src+3 ? 0 : 1);  // a rook will be 3 squares to right of king
                         mqi.side_black.rooks[rook_offset] = src+1;                   // that rook ends up 1 square right of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -1696,7 +2199,6 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
                     }
                     case K_Q_CASTLING:
                     {
-                        delta = -2;
                         int rook_offset = (mqi.side_black.rooks[0]==src-4 ? 0 : 1);  // a rook will be 4 squares to left of king
                         mqi.side_black.rooks[rook_offset] = src-1;                   // that rook ends up 1 square left of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -1705,7 +2207,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
                         break;
                     }
                 }
-                mqi.side_black.king = dst = src+delta;
+                mqi.side_black.king = dst = fast_king_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'k';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1717,14 +2219,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             {
                 int rook_offset = (hi_nibble==CODE_ROOK_LO ? 0 : 1 );
                 src = mqi.side_black.rooks[rook_offset];
-                if( code & R_RANK )                // code encodes rank ?
-                {
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                }
-                else
-                {
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
-                }
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 mqi.side_black.rooks[rook_offset] = dst;
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'r';
@@ -1743,11 +2238,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_BISHOP_DARK:
             {
                 src = mqi.side_black.bishop_dark;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=b8(1), dst=h2(55), file_delta=6  -> 9*6 =54
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'd';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1758,11 +2249,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_BISHOP_LIGHT:
             {
                 src = mqi.side_black.bishop_light;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=g8(6), dst=a2(48), file_delta=6  -> 7*6 =42
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'b';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1773,10 +2260,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_QUEEN_ROOK:
             {
                 src = mqi.side_black.queens[0];
-                if( code & R_RANK )                // code encodes rank ?
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                else
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1787,11 +2271,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             case CODE_QUEEN_BISHOP:
             {
                 src = mqi.side_black.queens[0];
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -1803,21 +2283,7 @@ bool MemoryPositionSearch::SearchGameOptimisedNoPromotionAllowed( const char *mo
             {
                 int knight_offset = ((code&N_HI) ? 1 : 0 );
                 src = mqi.side_black.knights[knight_offset];
-                int delta=0;
-                switch(code&7)          // 0, 1, 2, 3
-                {                       // 8, 9, 10,11
-                                        // 16,17,18,19
-                                        // 24,25,26,27
-                    case N_VECTOR_NNE:   delta = -15;   break; // 2-17
-                    case N_VECTOR_NEE:   delta = -6;    break; // 11-17
-                    case N_VECTOR_SEE:   delta = 10;    break; // 27-17
-                    case N_VECTOR_SSE:   delta = 17;    break; // 27-10
-                    case N_VECTOR_SSW:   delta = 15;    break; // 25-10
-                    case N_VECTOR_SWW:   delta = 6;     break; // 16-10
-                    case N_VECTOR_NWW:   delta = -10;   break; // 0-10
-                    case N_VECTOR_NNW:   delta = -17;   break; // 0-17
-                }
-                dst = src+delta;
+                dst = fast_knight_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'n';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2009,7 +2475,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
                 cprintf( "%s\n", buf );
             }
         } */
-        bool match = pm.Test( reverse, &mqi.side_white, &mqi.side_black, true, mqi.squares, false );
+        bool match = offset>=pattern_first_ply && pm.Test( reverse, &mqi.side_white, &mqi.side_black, true, mqi.squares, false );
         if( match )
         {
             /*if( debug_trigger )
@@ -2020,6 +2486,8 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             offset_last = offset_first = offset;    // later - separate offset_first and offset_last
             return true;
         }
+        if( offset >= pattern_last_ply )
+            return false;
         #define SIMPLE_PATTERN_COUNT_OPTIMISATION
         #ifdef SIMPLE_PATTERN_COUNT_OPTIMISATION
         if( total_count < ms.total_count_target )
@@ -2038,23 +2506,12 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_KING:
             {
                 src = mqi.side_white.king;
-                int delta=0;
-                switch( code&0x0f )     // 0, 1, 2
-                {                       // 8, 9, 10
-                                        // 16,17,18
+                switch( code&0x0f )
+                {
                     case 0: return false;   // CODE_KING = 0, so '\0' string terminator
-                    case K_VECTOR_NW:    delta = -9; break;  // 0-9
-                    case K_VECTOR_N:     delta = -8; break;  // 1-9
-                    case K_VECTOR_NE:    delta = -7; break;  // 2-9
-                    case K_VECTOR_W:     delta = -1; break;  // 8-9
-                    case K_VECTOR_E:     delta =  1; break;  // 10-9
-                    case K_VECTOR_SW:    delta =  7; break;  // 16-9
-                    case K_VECTOR_S:     delta =  8; break;  // 17-9
-                    case K_VECTOR_SE:    delta =  9; break;  // 18-9
                     case K_K_CASTLING:
                     {
                         // Idea: replace this with a single 32 bit ptr store of ' RK '
-                        delta = 2;
                         int rook_offset = (mqi.side_white.rooks[0]==src+3 ? 0 : 1);  // a rook will be 3 squares to right of king
                         mqi.side_white.rooks[rook_offset] = src+1;                   // that rook ends up 1 square right of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -2064,7 +2521,6 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
                     }
                     case K_Q_CASTLING:
                     {
-                        delta = -2;
                         int rook_offset = (mqi.side_white.rooks[0]==src-4 ? 0 : 1);  // a rook will be 4 squares to left of king
                         mqi.side_white.rooks[rook_offset] = src-1;                   // that rook ends up 1 square left of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -2073,7 +2529,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
                         break;
                     }
                 }
-                mqi.side_white.king = dst = src+delta;
+                mqi.side_white.king = dst = fast_king_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'K';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2085,14 +2541,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             {
                 int rook_offset = (hi_nibble==CODE_ROOK_LO ? 0 : 1 );
                 src = mqi.side_white.rooks[rook_offset];
-                if( code & R_RANK )                // code encodes rank ?
-                {
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                }
-                else
-                {
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
-                }
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 mqi.side_white.rooks[rook_offset] = dst;
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'R';
@@ -2111,11 +2560,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_BISHOP_DARK:
             {
                 src = mqi.side_white.bishop_dark;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=b8(1), dst=h2(55), file_delta=6  -> 9*6 =54
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'D';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2126,11 +2571,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_BISHOP_LIGHT:
             {
                 src = mqi.side_white.bishop_light;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=g8(6), dst=a2(48), file_delta=6  -> 7*6 =42
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'B';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2141,10 +2582,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_QUEEN_ROOK:
             {
                 src = mqi.side_white.queens[0];
-                if( code & R_RANK )                // code encodes rank ?
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                else
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'Q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2155,11 +2593,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_QUEEN_BISHOP:
             {
                 src = mqi.side_white.queens[0];
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'Q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2171,21 +2605,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             {
                 int knight_offset = ((code&N_HI) ? 1 : 0 );
                 src = mqi.side_white.knights[knight_offset];
-                int delta=0;
-                switch(code&7)          // 0, 1, 2, 3
-                {                       // 8, 9, 10,11
-                                        // 16,17,18,19
-                                        // 24,25,26,27
-                    case N_VECTOR_NNE:   delta = -15;   break; // 2-17
-                    case N_VECTOR_NEE:   delta = -6;    break; // 11-17
-                    case N_VECTOR_SEE:   delta = 10;    break; // 27-17
-                    case N_VECTOR_SSE:   delta = 17;    break; // 27-10
-                    case N_VECTOR_SSW:   delta = 15;    break; // 25-10
-                    case N_VECTOR_SWW:   delta = 6;     break; // 16-10
-                    case N_VECTOR_NWW:   delta = -10;   break; // 0-10
-                    case N_VECTOR_NNW:   delta = -17;   break; // 0-17
-                }
-                dst = src+delta;
+                dst = fast_knight_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'N';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2349,7 +2769,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
                 cprintf( "%s\n", buf );
             }
         } */
-        match = pm.Test( reverse, &mqi.side_white, &mqi.side_black, false, mqi.squares, false );
+        match = offset>=pattern_first_ply && pm.Test( reverse, &mqi.side_white, &mqi.side_black, false, mqi.squares, false );
         if( match )
         {
             /*if( debug_trigger )
@@ -2360,6 +2780,8 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             offset_last = offset_first = offset;    // later - separate offset_first and offset_last
             return true;
         }
+        if( offset >= pattern_last_ply )
+            return false;
         #ifdef SIMPLE_PATTERN_COUNT_OPTIMISATION
         if( total_count < ms.total_count_target )
             return false;
@@ -2377,22 +2799,11 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_KING:
             {
                 src = mqi.side_black.king;
-                int delta=0;
-                switch( code&0x0f )     // 0, 1, 2
-                {                       // 8, 9, 10
-                                        // 16,17,18
+                switch( code&0x0f )
+                {
                     case 0: return false;   // CODE_KING = 0, so '\0' string terminator
-                    case K_VECTOR_NW:    delta = -9; break;  // 0-9
-                    case K_VECTOR_N:     delta = -8; break;  // 1-9
-                    case K_VECTOR_NE:    delta = -7; break;  // 2-9
-                    case K_VECTOR_W:     delta = -1; break;  // 8-9
-                    case K_VECTOR_E:     delta =  1; break;  // 10-9
-                    case K_VECTOR_SW:    delta =  7; break;  // 16-9
-                    case K_VECTOR_S:     delta =  8; break;  // 17-9
-                    case K_VECTOR_SE:    delta =  9; break;  // 18-9
                     case K_K_CASTLING:
                     {
-                        delta = 2;
                         int rook_offset = (mqi.side_black.rooks[0]==src+3 ? 0 : 1);  // a rook will be 3 squares to right of king
                         mqi.side_black.rooks[rook_offset] = src+1;                   // that rook ends up 1 square right of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -2402,7 +2813,6 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
                     }
                     case K_Q_CASTLING:
                     {
-                        delta = -2;
                         int rook_offset = (mqi.side_black.rooks[0]==src-4 ? 0 : 1);  // a rook will be 4 squares to left of king
                         mqi.side_black.rooks[rook_offset] = src-1;                   // that rook ends up 1 square left of king
                         // note that there is no way the rooks ordering can swap during castling
@@ -2411,7 +2821,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
                         break;
                     }
                 }
-                mqi.side_black.king = dst = src+delta;
+                mqi.side_black.king = dst = fast_king_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'k';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2423,14 +2833,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             {
                 int rook_offset = (hi_nibble==CODE_ROOK_LO ? 0 : 1 );
                 src = mqi.side_black.rooks[rook_offset];
-                if( code & R_RANK )                // code encodes rank ?
-                {
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                }
-                else
-                {
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
-                }
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 mqi.side_black.rooks[rook_offset] = dst;
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'r';
@@ -2449,11 +2852,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_BISHOP_DARK:
             {
                 src = mqi.side_black.bishop_dark;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=b8(1), dst=h2(55), file_delta=6  -> 9*6 =54
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'd';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2464,11 +2863,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_BISHOP_LIGHT:
             {
                 src = mqi.side_black.bishop_light;
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=g8(6), dst=a2(48), file_delta=6  -> 7*6 =42
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'b';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2479,10 +2874,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_QUEEN_ROOK:
             {
                 src = mqi.side_black.queens[0];
-                if( code & R_RANK )                // code encodes rank ?
-                    dst = ((code<<3)&0x38) | (src&7);   // same file as src, rank from code
-                else
-                    dst = (src&0x38) | (code&7);        // same rank as src, file from code
+                dst = fast_rook_dst[code&0x0f][src];     // rank or file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2493,11 +2885,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             case CODE_QUEEN_BISHOP:
             {
                 src = mqi.side_black.queens[0];
-                int file_delta = (code&7) - (src&7);
-                if( code & B_FALL )  // FALL\ + file
-                    dst = src + 9*file_delta;   // eg src=a8(0), dst=h1(63), file_delta=7  -> 9*7 =63
-                else                  // RISE/ + file
-                    dst = src - 7*file_delta;   // eg src=h8(7), dst=a1(56), file_delta=7  -> 7*7 =49
+                dst = fast_bishop_dst[code&0x0f][src];   // diagonal and file from code
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'q';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2509,21 +2897,7 @@ bool MemoryPositionSearch::PatternSearchGameOptimisedNoPromotionAllowed( Pattern
             {
                 int knight_offset = ((code&N_HI) ? 1 : 0 );
                 src = mqi.side_black.knights[knight_offset];
-                int delta=0;
-                switch(code&7)          // 0, 1, 2, 3
-                {                       // 8, 9, 10,11
-                                        // 16,17,18,19
-                                        // 24,25,26,27
-                    case N_VECTOR_NNE:   delta = -15;   break; // 2-17
-                    case N_VECTOR_NEE:   delta = -6;    break; // 11-17
-                    case N_VECTOR_SEE:   delta = 10;    break; // 27-17
-                    case N_VECTOR_SSE:   delta = 17;    break; // 27-10
-                    case N_VECTOR_SSW:   delta = 15;    break; // 25-10
-                    case N_VECTOR_SWW:   delta = 6;     break; // 16-10
-                    case N_VECTOR_NWW:   delta = -10;   break; // 0-10
-                    case N_VECTOR_NNW:   delta = -17;   break; // 0-17
-                }
-                dst = src+delta;
+                dst = fast_knight_dst[code&0x0f][src];
                 captured = mqi.squares[dst];
                 mqi.squares[dst] = 'n';
                 mqi.squares[src] = EMPTY_CHARACTER;
@@ -2804,7 +3178,7 @@ bool MemoryPositionSearch::PatternSearchGameSlowPromotionAllowed( PatternMatch &
     int total_count=30;     // 32 - 2 kings
     SlowGameInit();
     int len = moves_in.size();
-    bool match = pm.Test( reverse, &msi.sides[0], &msi.sides[1], msi.cr.white, msi.cr.squares, false );
+    bool match = pattern_first_ply==0 && pm.Test( reverse, &msi.sides[0], &msi.sides[1], msi.cr.white, msi.cr.squares, false );
     if( match )
     {
         offset_last = offset_first = 0;    // later - separate offset_first and offset_last
@@ -2842,12 +3216,14 @@ bool MemoryPositionSearch::PatternSearchGameSlowPromotionAllowed( PatternMatch &
                 msi.cr.squares[mv.dst] = c;
             }
         }
-        match = pm.Test( reverse, &msi.sides[0], &msi.sides[1], msi.cr.white, msi.cr.squares, true );
+        match = i+1>=pattern_first_ply && pm.Test( reverse, &msi.sides[0], &msi.sides[1], msi.cr.white, msi.cr.squares, true );
         if( match )
         {
             offset_last = offset_first = (i+1);    // later - separate offset_first and offset_last
             return true;
         }
+        if( i+1 >= pattern_last_ply )
+            return false;
         #ifdef SIMPLE_PATTERN_COUNT_OPTIMISATION
         if( isalpha(mv.capture) )
         {
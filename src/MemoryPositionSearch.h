@@ -11,6 +11,8 @@
 #include <algorithm>
 #include <vector>
 #include <string>
+#include <map>
+#include <unordered_map>
 #include "thc.h"
 #include "ProgressBar.h"
 #include "ListableGame.h"
@@ -113,6 +115,9 @@ struct MpsQuickInit
     char squares[64];
 };
 
+// DoSearch() and DoPatternSearch() share games out to threads in chunks of this many
+#define MPS_SEARCH_CHUNK 256
+
 struct DoSearchFoundGame
 {
     int idx;            // index into memory db
@@ -121,6 +126,132 @@ struct DoSearchFoundGame
     unsigned short offset_last;
 };
 
+// Game header filter for DoSearch() and DoPatternSearch(), games that fail it are
+//  skipped before their moves are decoded. Zero fields don't filter
+struct MpsFilter
+{
+    MpsFilter() { min_elo=0; min_date=0; max_date=0; result_mask=0; }
+    int      min_elo;           // both players rated at least this
+    uint32_t min_date;          // Date2Bin() format, so min_date=Date2Bin("2010") is since 2010
+    uint32_t max_date;
+    unsigned int result_mask;   // bit 1<<ResultBin() set for each result wanted
+    bool IsActive() const { return min_elo>0 || min_date>0 || max_date>0 || result_mask!=0; }
+    bool operator ==( const MpsFilter &other ) const
+    {
+        return min_elo==other.min_elo && min_date==other.min_date && max_date==other.max_date &&
+               result_mask==other.result_mask;
+    }
+};
+
+// The header fields the filter tests, one array per field for a whole game source so
+//  that testing every game is a simple loop the compiler can vectorise. Built on the
+//  first filtered search of a source, rebuilt if the source has changed
+struct MpsHeaderColumns
+{
+    MpsHeaderColumns() { Clear(); }
+    void Clear() { source=NULL; first_game_id=last_game_id=0; white_elo.clear(); black_elo.clear(); date.clear(); result.clear(); }
+    const std::vector< smart_ptr<ListableGame> > *source;
+    uint32_t first_game_id;
+    uint32_t last_game_id;
+    std::vector<uint16_t> white_elo;
+    std::vector<uint16_t> black_elo;
+    std::vector<uint32_t> date;
+    std::vector<uint8_t>  result;
+};
+
+// The material signature and pawn structure indexes (see CompressMoves::MaterialSpans()
+//  and PawnSpans()) of a chunk of games, all their spans in game order. Game k of the
+//  chunk's spans are material[] from material_offsets[k] up to material_offsets[k+1]
+//  and the same for pawn[]
+struct MpsSpanChunk
+{
+    MpsSpanChunk() { material_built=pawn_built=false; }
+    bool material_built;
+    bool pawn_built;
+    std::vector<MaterialSpan> material;
+    std::vector<uint32_t>     material_offsets;
+    std::vector<PawnSpan>     pawn;
+    std::vector<uint32_t>     pawn_offsets;
+};
+
+// Span indexes for the games of a source, kept here rather than with each game so
+//  that ListableGames stay small. Built a chunk at a time by whichever thread first
+//  searches the chunk, rebuilt if the source has changed. GameDocuments' moves can
+//  change under us, so they have no spans and are searched ply by ply instead
+struct MpsSpanIndex
+{
+    MpsSpanIndex() { Clear(); }
+    void Clear() { source=NULL; nbr_games=0; first_game_id=last_game_id=0; chunks.clear(); }
+    const std::vector< smart_ptr<ListableGame> > *source;
+    size_t   nbr_games;
+    uint32_t first_game_id;
+    uint32_t last_game_id;
+    std::vector<MpsSpanChunk> chunks;   // one per MPS_SEARCH_CHUNK games
+};
+
+// Each move in a given position has stats associated with it
+struct MOVE_STATS
+{
+    int nbr_games;
+    int nbr_white_wins;
+    int nbr_black_wins;
+    int nbr_draws;
+
+    // Sort according to number of games
+    bool operator < (const MOVE_STATS& ms)  const { return nbr_games < ms.nbr_games; }
+    bool operator > (const MOVE_STATS& ms)  const { return nbr_games > ms.nbr_games; }
+    bool operator == (const MOVE_STATS& ms) const { return nbr_games == ms.nbr_games; }
+};
+
+// Individual path to a given position
+struct PATH_TO_POSITION
+{
+    PATH_TO_POSITION() { frequency=0; }
+    int frequency;
+    std::string blob;
+
+    // Sort according to frequency
+    bool operator < (const PATH_TO_POSITION& ptp)  const { return frequency < ptp.frequency; }
+    bool operator > (const PATH_TO_POSITION& ptp)  const { return frequency > ptp.frequency; }
+    bool operator == (const PATH_TO_POSITION& ptp) const { return frequency == ptp.frequency; }
+};
+
+// Results, next moves and transpositions (paths to the position) of the games found
+//  by a position search. Paths are indexed by a hash of their compressed moves, so a
+//  game's path is found without copying it or comparing it to every other path
+class PositionStats
+{
+public:
+    PositionStats() { Clear(); }
+    void Clear();
+    void AddGame( const char *blob, int result, unsigned short offset_first, unsigned short offset_last );  // result is ListableGame::ResultBin()
+    void Merge( const PositionStats &other );
+    void Sort();    // most frequent transpositions first
+
+    // Index of the transposition a game's compressed moves start with (-1 if none)
+    //  and the length of that path
+    int  FindTransposition( const char *blob, size_t &len ) const;
+
+    int total_white_wins;
+    int total_black_wins;
+    int total_draws;
+    std::map< char, MOVE_STATS > stats;  // map each compressed move in the position to move stats
+    std::vector< PATH_TO_POSITION > transpositions;
+
+private:
+    int  Find( const char *blob, size_t len, uint64_t hash ) const;
+    int  Insert( const char *blob, size_t len, uint64_t hash );
+    std::unordered_multimap< uint64_t, int > index;    // hash of path -> idx into transpositions
+    std::vector<size_t> lengths;                        // distinct path lengths, ascending
+};
+
+// The games found (and optionally their stats) for one position of a DoBatchSearch()
+struct MpsBatchResult
+{
+    std::vector<DoSearchFoundGame> games_found;
+    PositionStats stats;
+};
+
 class MemoryPositionSearch
 {
 public:
@@ -129,6 +260,9 @@ public:
         Init();
     }
     void Init();
+    void SetThreads( int nbr ) { nbr_threads_requested = nbr; }         // for searches, 0 = one per hardware thread
+    void SetFilter( const MpsFilter &f );                               // for searches from now on
+    const MpsFilter &GetFilter() { return filter; }
     bool TryFastMode( MpsSide *side );
     bool SearchGameOptimisedNoPromotionAllowed( const char *moves_in, unsigned short &offset_first, unsigned short &offset_last  );    // much faster
     bool SearchGameSlowPromotionAllowed(  const std::string &moves_in, unsigned short &offset_first, unsigned short &offset_last  );          // semi fast
@@ -138,20 +272,51 @@ public:
     std::vector< smart_ptr<ListableGame> > *search_source;
     std::vector< smart_ptr<ListableGame> >  &GetVectorSourceGames()   { return *search_source; }
     std::vector<DoSearchFoundGame>          &GetVectorGamesFound() { return games_found; }
-    int  DoSearch( const thc::ChessPosition &cp, ProgressBar *progress );
-    int  DoSearch( const thc::ChessPosition &cp, ProgressBar *progress, std::vector< smart_ptr<ListableGame> > *source );
+    int  DoSearch( const thc::ChessPosition &cp, ProgressBar *progress, bool calculate_stats=false );
+    int  DoSearch( const thc::ChessPosition &cp, ProgressBar *progress, std::vector< smart_ptr<ListableGame> > *source, bool calculate_stats=false );
+
+    // The same search, a few games at a time (eg a screenful first then more as needed).
+    //  Stats are only available once the search is complete
+    void DoSearchStart( const thc::ChessPosition &cp, std::vector< smart_ptr<ListableGame> > *source, bool calculate_stats=false );
+    int  DoSearchContinue( int nbr_wanted, ProgressBar *progress=NULL );
+    bool IsSearchComplete() { return search_next_chunk >= search_nbr_chunks; }
     int  DoPatternSearch( PatternMatch &pm, ProgressBar *progress, PATTERN_STATS &stats );
+
+    // Search for many positions at once, in one pass over the games. Results (one per
+    //  target, in the same order) are as for DoSearch() except that the side to move must
+    //  match too, positions are matched by hash and a game's offset_first and offset_last
+    //  are both the ply of the position's first occurrence. Doesn't change the results
+    //  of the last DoSearch(). Returns the total number of games found over all targets
+    int  DoBatchSearch( const std::vector<thc::ChessPosition> &targets, ProgressBar *progress, std::vector<MpsBatchResult> &results, bool calculate_stats=false );
+    int  DoBatchSearch( const std::vector<thc::ChessPosition> &targets, ProgressBar *progress, std::vector<MpsBatchResult> &results, std::vector< smart_ptr<ListableGame> > *source, bool calculate_stats=false );
     int  DoPatternSearch( PatternMatch &pm, ProgressBar *progress, PATTERN_STATS &stats, std::vector< smart_ptr<ListableGame> > *source );
     bool IsThisSearchPosition( const thc::ChessPosition &cp )
         { return search_position_set && cp==search_position; }
 
+    // Stats for the games found by the last DoSearch(), if it calculated them
+    bool HavePositionStats() { return position_stats_valid; }
+    PositionStats &GetPositionStats() { return position_stats; }
+
 public:
     std::vector< smart_ptr<ListableGame> > in_memory_game_cache;
 
 private:
     thc::ChessPosition search_position;
     bool search_position_set;
+    int  nbr_threads_requested;
+    const uint8_t *search_pass;         // search in progress, see DoSearchContinue()
+    bool search_calculate_stats;
+    int  search_nbr_chunks;
+    int  search_next_chunk;
+    MpsFilter filter;
+    MpsHeaderColumns columns;
+    std::vector<uint8_t> filter_pass;   // for each game of the source, 1 if it passes the filter
+    MpsSpanIndex span_index;
+    unsigned short pattern_first_ply;   // pattern searches only test plies in this range
+    unsigned short pattern_last_ply;
     std::vector<DoSearchFoundGame> games_found;
+    PositionStats position_stats;
+    bool         position_stats_valid;
     MpsSlow      ms;
     MpsSlowInit  msi;
     MpsQuick     mq;
@@ -174,6 +339,14 @@ private:
         msi.sides[0] = mqi_init.side_white;
         msi.sides[1] = mqi_init.side_black;
     }
+    const uint8_t *FilterGames( std::vector< smart_ptr<ListableGame> > *source );     // NULL if no filter
+    void DoSearchPrime( const thc::ChessPosition &cp );
+    void SearchGames( std::vector< smart_ptr<ListableGame> > *source, int begin, int end, const uint8_t *pass,
+                      std::vector<DoSearchFoundGame> &found, PositionStats *stats );
+    void PatternSearchPrime( PatternMatch &pm );
+    MpsSpanIndex *SpanIndex( PatternMatch &pm, std::vector< smart_ptr<ListableGame> > *source );    // NULL if not needed
+    void PatternSearchGames( PatternMatch &pm, std::vector< smart_ptr<ListableGame> > *source, int begin, int end, const uint8_t *pass,
+                             MpsSpanIndex *spans, PATTERN_STATS &stats, std::vector<DoSearchFoundGame> &found );
     thc::Move UncompressSlowMode( char code );
     thc::Move UncompressFastMode( char code, MpsSide *side, MpsSide *other );
 };
@@ -198,6 +198,45 @@ bool MoveTree::SeekCrawler( int& level, const MoveTree *target, thc::ChessRules
     return done;
 }
 
+// List every move in the tree under here with the position it's played from
+//   Unlike SeekCrawler() a node's variations start from the position before its move
+//   (they're alternatives to it), and nothing is popped so there's no limit on line length
+void MoveTree::Nodes( std::vector<MOVE_TREE_NODE> &nodes )
+{
+    nodes.clear();
+    int level=-1;
+    if( root )
+    {
+        thc::ChessRules cr;
+        cr = *root;
+        NodesCrawler( level, cr, nodes );
+    }
+}
+
+void MoveTree::NodesCrawler( int& level, thc::ChessRules &cr, std::vector<MOVE_TREE_NODE> &nodes )
+{
+    level++;
+    thc::ChessPosition cp_before_move = cr;
+    if( level>0 )
+    {
+        MOVE_TREE_NODE n;
+        n.node = this;
+        n.cp   = cp_before_move;
+        nodes.push_back(n);
+        cr.PlayMove(game_move.move);
+    }
+    int nbr_vars=variations.size();
+    for( int i=0; i<nbr_vars; i++ )
+    {
+        thc::ChessRules cr_temp = cp_before_move;
+        vector<MoveTree> &var = variations[i];
+        int nbr_moves=var.size();
+        for( int j=0; j<nbr_moves; j++ )
+            var[j].NodesCrawler( level, cr_temp, nodes );
+    }
+    level--;
+}
+
 
 
 // Promote the entire variation containing a child node
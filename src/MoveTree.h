@@ -29,6 +29,7 @@ struct GAME_MOVE
 };
 
 struct VARIATION_STACK_ELEMENT;
+struct MOVE_TREE_NODE;
 
 
 class MoveTree
@@ -74,6 +75,11 @@ public:
     //  returns true if found successfully
     bool Seek( const MoveTree *target, thc::ChessRules &cr );
     bool SeekCrawler( int& level, const MoveTree *target, thc::ChessRules &cr, bool done );
+
+    // List every move in the tree under here with the position it's played from, in
+    //  the order they're written (each move before the variations replacing it)
+    void Nodes( std::vector<MOVE_TREE_NODE> &nodes );
+    void NodesCrawler( int& level, thc::ChessRules &cr, std::vector<MOVE_TREE_NODE> &nodes );
 };
 
 
@@ -85,4 +91,10 @@ struct VARIATION_STACK_ELEMENT
     int imove=-1;
 };
 
+struct MOVE_TREE_NODE
+{
+    MoveTree *node=NULL;
+    thc::ChessPosition cp;      // position before node's move
+};
+
 #endif //MOVE_TREE_H
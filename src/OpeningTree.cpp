@@ -0,0 +1,315 @@
+/****************************************************************************
+ * Opening tree, next move statistics for the database's popular positions,
+ *  built once from the games and saved alongside the database
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <unordered_map>
+#include "CompressMoves.h"
+#include "OpeningTree.h"
+
+#define OPENING_TREE_MAGIC   0x4c4c4154      // "TALL"
+#define OPENING_TREE_VERSION 1
+
+// The first pass counts positions approximately in two tables of saturating
+//  counters, indexed by different bits of the key. Collisions only ever add to
+//  a count so every position reached in min_games games passes both counts, the
+//  second pass then counts the (few) positions that pass exactly
+#define OPENING_TREE_COUNTER_BITS 24
+#define OPENING_TREE_COUNTER_MASK ((1u<<OPENING_TREE_COUNTER_BITS)-1)
+
+// Exact counts for a candidate position in the second pass
+struct OpeningTreeMoveCount
+{
+    thc::Move move;
+    uint32_t nbr_games;
+    uint32_t white_wins;
+    uint32_t draws;
+    uint32_t black_wins;
+    uint32_t nbr_rated;
+    uint64_t elo_total;
+};
+
+struct OpeningTreePositionCount
+{
+    uint32_t nbr_games;
+    uint32_t white_wins;
+    uint32_t draws;
+    uint32_t black_wins;
+    uint32_t nbr_within_depth;  // games reaching it by ply depth
+    std::vector<OpeningTreeMoveCount> moves;
+};
+
+void OpeningTree::Clear()
+{
+    positions.clear();
+    moves.clear();
+    nbr_source_games = 0;
+    depth = 0;
+    min_games = 0;
+}
+
+// Keys of the positions in a game up to and including ply len, with 0 replacing
+//  all but the first occurrence of each position
+static void FirstOccurrenceKeys( std::vector<uint64_t> &keys )
+{
+    for( size_t i=0; i<keys.size(); i++ )
+    {
+        keys[i] = Hash64Key( keys[i], i%2==0 );
+        for( size_t j=i%2; j<i; j+=2 )
+        {
+            if( keys[j] == keys[i] )
+            {
+                keys[i] = 0;
+                break;
+            }
+        }
+    }
+}
+
+bool OpeningTree::Build( std::vector< smart_ptr<ListableGame> > &games, int depth_, int min_games_,
+                         int &permill, bool &kill )
+{
+    Clear();
+    depth = depth_;
+    min_games = min_games_;
+    nbr_source_games = static_cast<uint32_t>(games.size());
+    size_t nbr = games.size();
+    unsigned int threshold = std::min( std::max(min_games,1), 255 );
+    std::vector<uint8_t> counts_lo( OPENING_TREE_COUNTER_MASK+1, 0 );
+    std::vector<uint8_t> counts_hi( OPENING_TREE_COUNTER_MASK+1, 0 );
+    CompressMoves press;
+    std::vector<uint64_t> keys;
+    std::vector<thc::Move> game_moves;
+
+    // Pass 1, approximate counts
+    for( size_t i=0; i<nbr; i++ )
+    {
+        if( kill )
+            return false;
+        if( (i&0x3ff) == 0 )
+            permill = static_cast<int>( (i*500) / nbr );
+        const smart_ptr<ListableGame> &p = games[i];
+        const char *fen = p->Fen();
+        if( fen && *fen )
+            continue;
+        const char *blob = p->CompressedMoves();
+        size_t len = strnlen( blob, depth );
+        thc::ChessPosition start;
+        press.Hash64Batch( start, blob, len, keys );
+        FirstOccurrenceKeys( keys );
+        for( uint64_t key: keys )
+        {
+            if( key == 0 )
+                continue;
+            uint8_t &lo = counts_lo[ key & OPENING_TREE_COUNTER_MASK ];
+            uint8_t &hi = counts_hi[ (key>>OPENING_TREE_COUNTER_BITS) & OPENING_TREE_COUNTER_MASK ];
+            if( lo < 255 )
+                lo++;
+            if( hi < 255 )
+                hi++;
+        }
+    }
+
+    // Pass 2, exact counts for positions that passed both approximate counts
+    std::unordered_map< uint64_t, OpeningTreePositionCount > candidates;
+    for( size_t i=0; i<nbr; i++ )
+    {
+        if( kill )
+            return false;
+        if( (i&0x3ff) == 0 )
+            permill = static_cast<int>( 500 + (i*500) / nbr );
+        const smart_ptr<ListableGame> &p = games[i];
+        const char *fen = p->Fen();
+        if( fen && *fen )
+            continue;
+        // Positions up to ply 2*depth, and the move after the last of them
+        const char *blob = p->CompressedMoves();
+        size_t len = strnlen( blob, 2*depth+1 );
+        thc::ChessPosition start;
+        press.Hash64Batch( start, blob, len, keys, &game_moves );
+        FirstOccurrenceKeys( keys );
+        int result = p->ResultBin();
+        int white_elo = p->WhiteEloBin();
+        int black_elo = p->BlackEloBin();
+        for( size_t ply=0; ply<keys.size() && ply<=static_cast<size_t>(2*depth); ply++ )
+        {
+            uint64_t key = keys[ply];
+            if( key == 0 ||
+                counts_lo[ key & OPENING_TREE_COUNTER_MASK ] < threshold ||
+                counts_hi[ (key>>OPENING_TREE_COUNTER_BITS) & OPENING_TREE_COUNTER_MASK ] < threshold )
+                continue;
+            OpeningTreePositionCount &pc = candidates[key];
+            if( ply <= static_cast<size_t>(depth) )
+                pc.nbr_within_depth++;
+            pc.nbr_games++;
+            switch( result )
+            {
+                case 1: pc.white_wins++;    break;
+                case 2: pc.black_wins++;    break;
+                case 3: pc.draws++;         break;
+            }
+            if( ply < game_moves.size() )
+            {
+                thc::Move mv = game_moves[ply];
+                OpeningTreeMoveCount *mc = NULL;
+                for( OpeningTreeMoveCount &m: pc.moves )
+                {
+                    if( m.move == mv )
+                    {
+                        mc = &m;
+                        break;
+                    }
+                }
+                if( !mc )
+                {
+                    OpeningTreeMoveCount empty = OpeningTreeMoveCount();
+                    empty.move = mv;
+                    pc.moves.push_back( empty );
+                    mc = &pc.moves.back();
+                }
+                mc->nbr_games++;
+                switch( result )
+                {
+                    case 1: mc->white_wins++;   break;
+                    case 2: mc->black_wins++;   break;
+                    case 3: mc->draws++;        break;
+                }
+                if( white_elo>0 && black_elo>0 )
+                {
+                    mc->nbr_rated++;
+                    mc->elo_total += static_cast<uint64_t>(white_elo+black_elo);
+                }
+            }
+        }
+    }
+
+    // Keep the positions that really were reached in min_games games, in key order
+    //  with their moves most played first
+    std::vector<uint64_t> tree_keys;
+    for( const std::pair<const uint64_t,OpeningTreePositionCount> &kv: candidates )
+    {
+        if( kv.second.nbr_within_depth >= static_cast<uint32_t>(min_games) )
+            tree_keys.push_back( kv.first );
+    }
+    std::sort( tree_keys.begin(), tree_keys.end() );
+    for( uint64_t key: tree_keys )
+    {
+        OpeningTreePositionCount &pc = candidates[key];
+        std::stable_sort( pc.moves.begin(), pc.moves.end(),
+            []( const OpeningTreeMoveCount &a, const OpeningTreeMoveCount &b ) { return a.nbr_games > b.nbr_games; } );
+        OpeningTreePosition pos;
+        pos.key        = key;
+        pos.nbr_games  = pc.nbr_games;
+        pos.white_wins = pc.white_wins;
+        pos.draws      = pc.draws;
+        pos.black_wins = pc.black_wins;
+        pos.first_move = static_cast<uint32_t>(moves.size());
+        pos.nbr_moves  = static_cast<uint32_t>(pc.moves.size());
+        positions.push_back( pos );
+        for( const OpeningTreeMoveCount &mc: pc.moves )
+        {
+            OpeningTreeMove m;
+            m.move        = mc.move;
+            m.nbr_games   = mc.nbr_games;
+            m.white_wins  = mc.white_wins;
+            m.draws       = mc.draws;
+            m.black_wins  = mc.black_wins;
+            m.average_elo = mc.nbr_rated ? static_cast<uint32_t>( mc.elo_total / (2*mc.nbr_rated) ) : 0;
+            moves.push_back( m );
+        }
+    }
+    permill = 1000;
+    return true;
+}
+
+// Save tree. Returns bool error
+bool OpeningTree::Save( const std::string &filename, std::string &error_msg )
+{
+    FILE *outfile = fopen( filename.c_str(), "wb" );
+    if( outfile == NULL )
+    {
+        error_msg = "Cannot open " + filename + " for writing";
+        return true;
+    }
+    uint32_t header[7];
+    header[0] = OPENING_TREE_MAGIC;
+    header[1] = OPENING_TREE_VERSION;
+    header[2] = nbr_source_games;
+    header[3] = static_cast<uint32_t>(depth);
+    header[4] = static_cast<uint32_t>(min_games);
+    header[5] = static_cast<uint32_t>(positions.size());
+    header[6] = static_cast<uint32_t>(moves.size());
+    bool error = ( 1 != fwrite( header, sizeof(header), 1, outfile ) );
+    if( !error && !positions.empty() )
+        error = ( positions.size() != fwrite( &positions[0], sizeof(OpeningTreePosition), positions.size(), outfile ) );
+    if( !error && !moves.empty() )
+        error = ( moves.size() != fwrite( &moves[0], sizeof(OpeningTreeMove), moves.size(), outfile ) );
+    if( 0 != fclose(outfile) )
+        error = true;
+    if( error )
+        error_msg = "Cannot write " + filename;
+    return error;
+}
+
+// Load tree. Returns bool error
+bool OpeningTree::Load( const std::string &filename, size_t nbr_games, int depth_, int min_games_, std::string &error_msg )
+{
+    Clear();
+    FILE *infile = fopen( filename.c_str(), "rb" );
+    if( infile == NULL )
+    {
+        error_msg = "Cannot open " + filename + " for reading";
+        return true;
+    }
+    uint32_t header[7];
+    bool error = ( 1 != fread( header, sizeof(header), 1, infile ) );
+    if( error || header[0]!=OPENING_TREE_MAGIC || header[1]!=OPENING_TREE_VERSION )
+    {
+        error_msg = "File " + filename + " is not an opening tree file, or is from another version of this program";
+        error = true;
+    }
+    else if( header[2]!=nbr_games || header[3]!=static_cast<uint32_t>(depth_) || header[4]!=static_cast<uint32_t>(min_games_) )
+    {
+        error_msg = "File " + filename + " is out of date";
+        error = true;
+    }
+    else
+    {
+        nbr_source_games = header[2];
+        depth     = depth_;
+        min_games = min_games_;
+        positions.resize( header[5] );
+        moves.resize( header[6] );
+        if( !positions.empty() )
+            error = ( positions.size() != fread( &positions[0], sizeof(OpeningTreePosition), positions.size(), infile ) );
+        if( !error && !moves.empty() )
+            error = ( moves.size() != fread( &moves[0], sizeof(OpeningTreeMove), moves.size(), infile ) );
+        for( size_t i=0; !error && i<positions.size(); i++ )
+        {
+            if( positions[i].first_move+positions[i].nbr_moves > moves.size() || (i>0 && positions[i-1].key>=positions[i].key) )
+                error = true;
+        }
+        if( error )
+            error_msg = "File " + filename + " is damaged";
+    }
+    fclose( infile );
+    if( error )
+        Clear();
+    return error;
+}
+
+const OpeningTreePosition *OpeningTree::Lookup( const thc::ChessPosition &cp ) const
+{
+    thc::ChessPosition temp = cp;     // Hash64Calculate() isn't const
+    uint64_t key = Hash64Key( temp.Hash64Calculate(), cp.white );
+    auto it = std::lower_bound( positions.begin(), positions.end(), key,
+        []( const OpeningTreePosition &pos, uint64_t k ) { return pos.key < k; } );
+    if( it==positions.end() || it->key!=key )
+        return NULL;
+    return &*it;
+}
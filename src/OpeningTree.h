@@ -0,0 +1,74 @@
+/****************************************************************************
+ * Opening tree, next move statistics for the database's popular positions,
+ *  built once from the games and saved alongside the database
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef OPENING_TREE_H
+#define OPENING_TREE_H
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "thc.h"
+#include "ListableGame.h"
+#include "CompressMoves.h"
+
+// A move played in a tree position, and the games that played it
+struct OpeningTreeMove
+{
+    thc::Move move;
+    uint32_t nbr_games;
+    uint32_t white_wins;
+    uint32_t draws;
+    uint32_t black_wins;
+    uint32_t average_elo;   // of both players, over games with both Elos known, 0 if none
+};
+
+// A position in the tree. Its moves are contiguous, moves[first_move] onwards,
+//  most played first. The game counts include games that end in the position
+struct OpeningTreePosition
+{
+    uint64_t key;           // see Hash64Key()
+    uint32_t nbr_games;
+    uint32_t white_wins;
+    uint32_t draws;
+    uint32_t black_wins;
+    uint32_t first_move;
+    uint32_t nbr_moves;
+};
+
+// Positions are counted as MemoryPositionSearch::DoSearch() counts them, once per game
+//  at their first occurrence. The tree has every position reached within the first
+//  depth plies of at least min_games games. Games that reach a tree position later,
+//  by up to another depth plies, are counted too
+class OpeningTree
+{
+public:
+    OpeningTree() { Clear(); }
+    void Clear();
+    bool IsEmpty() const { return positions.empty(); }
+
+    // Build from games' compressed moves (games with a start position are skipped),
+    //  in two passes, progress 0-1000 over both. Returns false if killed
+    bool Build( std::vector< smart_ptr<ListableGame> > &games, int depth, int min_games,
+                int &permill, bool &kill );
+
+    // Save and load, return bool error. A tree built from a different number of
+    //  games or with different parameters won't load
+    bool Save( const std::string &filename, std::string &error_msg );
+    bool Load( const std::string &filename, size_t nbr_games, int depth, int min_games, std::string &error_msg );
+
+    // NULL if the position isn't in the tree
+    const OpeningTreePosition *Lookup( const thc::ChessPosition &cp ) const;
+    const OpeningTreeMove *Moves( const OpeningTreePosition *pos ) const { return &moves[pos->first_move]; }
+
+private:
+    std::vector<OpeningTreePosition> positions;     // sorted by key
+    std::vector<OpeningTreeMove>     moves;
+    uint32_t nbr_source_games;
+    int depth;
+    int min_games;
+};
+
+#endif // OPENING_TREE_H
@@ -5,6 +5,7 @@
  *  Copyright 2010-2015, Bill Forster <billforsternz at gmail dot com>
  ****************************************************************************/
 #include "CompressMoves.h"
+#include "DecodeCache.h"
 #include "PackedGame.h"
 
 #define HDR_LEN_SINGLE 12    // '1' + single byte offsets of 11 fields
@@ -254,8 +255,7 @@ void PackedGame::Unpack( CompactGame &pact )
 {
     std::string blob;
     Unpack( pact.r, blob );
-    CompressMoves press( pact.GetStartPosition() );
-    pact.moves = press.Uncompress( blob );
+    gbl_decode_cache.Uncompress( pact.game_id, pact.GetStartPosition(), blob, pact.moves );  // set pact.game_id first to avoid decoding again
 }
 
 
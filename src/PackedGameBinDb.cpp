@@ -8,6 +8,7 @@
 #include <map>
 #include <string>
 #include "CompressMoves.h"
+#include "DecodeCache.h"
 #include "BinDb.h"
 #include "BinaryBlock.h"
 #include "PackedGameBinDb.h"
@@ -154,8 +155,7 @@ void PackedGameBinDb::Unpack( CompactGame &pact )
 {
     std::string blob;
     Unpack( pact.r, blob );
-    CompressMoves press( pact.GetStartPosition() );
-    pact.moves = press.Uncompress( blob );
+    gbl_decode_cache.Uncompress( pact.game_id, pact.GetStartPosition(), blob, pact.moves );  // set pact.game_id first to avoid decoding again
 }
 
 
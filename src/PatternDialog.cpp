@@ -133,6 +133,9 @@ void PatternDialog::CreateControls()
         dont_allow_more = new wxCheckBox( this, ID_PATTERN_DONT_ALLOW_MORE,
            wxT("&Don't allow more pieces"), wxDefaultPosition, wxDefaultSize, 0 );
         dont_allow_more->SetValue( parm->dont_allow_more_pieces );
+        pawn_structure = new wxCheckBox( this, ID_PATTERN_PAWN_STRUCTURE,
+           wxT("&Pawn structure only"), wxDefaultPosition, wxDefaultSize, 0 );
+        pawn_structure->SetValue( parm->pawn_structure );
     }
     if( b_pawns )
     {
@@ -182,6 +185,8 @@ void PatternDialog::CreateControls()
     {
         castling_box->Add( dont_allow_more, 0,
             wxALL, 5);
+        castling_box->Add( pawn_structure, 0,
+            wxALL, 5);
     }
     if( b_pawns )
     {
@@ -352,6 +357,9 @@ void PatternDialog::SetDialogHelp()
     {
         FindWindow(ID_PATTERN_DONT_ALLOW_MORE)->SetHelpText(help3);
         FindWindow(ID_PATTERN_DONT_ALLOW_MORE)->SetToolTip(help3);
+        wxString help6 = "Set to find games where all the pawns (and only those pawns) are on the same squares as in the search pattern, wherever the pieces are";
+        FindWindow(ID_PATTERN_PAWN_STRUCTURE)->SetHelpText(help6);
+        FindWindow(ID_PATTERN_PAWN_STRUCTURE)->SetToolTip(help6);
     }
     if( b_pawns )
     {
@@ -450,6 +458,9 @@ void PatternDialog::OnHelpClick( wxCommandEvent& WXUNUSED(event) )
       "Put the pieces you want on the board, and the search will locate games where those pieces occupied those squares. "
       "The material balance search is also available, and is more flexible (but also more complicated). To make the material balance "
       "search more like the pattern search, lock down the position of pieces you care about with right clicks."
+      "\n\n"
+      "To search for a pawn structure (for example an isolated queen's pawn) set up the pawns and select \"Pawn structure only\", "
+      "the pieces are then ignored."
      );
     wxMessageBox(helpText,
       wxT("Pattern Dialog Help"),
@@ -480,7 +491,10 @@ void PatternDialog::OnOkClick( wxCommandEvent& WXUNUSED(event) )
             parm->more_pieces_bp = more_pieces_bp->GetValue();
         }
         if( b_dont_allow_more )
+        {
             parm->dont_allow_more_pieces             = dont_allow_more->GetValue();
+            parm->pawn_structure                = pawn_structure->GetValue();
+        }
         if( b_pawns )
             parm->pawns_must_be_on_same_files   = pawns_same_files->GetValue();
         if( b_bishops )
@@ -29,6 +29,7 @@ enum
     ID_PATTERN_INC_REFLECTION,
     ID_PATTERN_INC_REVERSE,
     ID_PATTERN_DONT_ALLOW_MORE,
+    ID_PATTERN_PAWN_STRUCTURE,
     ID_PATTERN_PAWNS_SAME_FILES,
     ID_PATTERN_BISHOPS_SAME_COLOUR,
     ID_PATTERN_LOCKDOWN_WK,
@@ -118,6 +119,7 @@ private:
     wxCheckBox*     pawns_same_files;
     wxCheckBox*     bishops_same_colour;
     wxCheckBox*     dont_allow_more;
+    wxCheckBox*     pawn_structure;
     wxCheckBox*     more_pieces_wq;
     wxCheckBox*     more_pieces_wr;
     wxCheckBox*     more_pieces_wb;
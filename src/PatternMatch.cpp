@@ -171,7 +171,8 @@ void PatternMatch::PrimePattern( const thc::ChessPosition *rover )
             case 3: target = &target_rm;  break;
         }
 
-        // Initialise material balance structures for both sides
+        // Initialise material balance structures for both sides, and the pawn structure
+        target->pawn_hash = PawnStructureHash( target->cp.squares );
         InitSide( &target->side_w, true, target->cp.squares );
         InitSide( &target->side_b, false, target->cp.squares );
 
@@ -295,6 +296,41 @@ bool PatternMatch::TestPattern( bool &reverse, bool white, const char *squares_r
     return match;
 }
 
+bool PatternMatch::TestPawnStructure( bool &reverse, bool white, uint64_t pawn_hash )
+{
+    bool match=false;
+    for( int i=0; !match && i<reflect_and_reverse; i++ )
+    {
+        PatternMatchTarget *target;
+        switch(i)
+        {
+            default:
+            case 0: target = &target_n;   reverse=false; break;
+            case 1: target = &target_m;   reverse=false; break;
+            case 2: target = &target_r;   reverse=true;  break;
+            case 3: target = &target_rm;  reverse=true;  break;
+        }
+        if( reflect_and_reverse==3 && i==1 )    // reflect_and_reverse==3 means do i==0 and i==2
+            continue;
+        match = (target->parm.either_to_move || (white==target->parm.white_to_move)) && pawn_hash==target->pawn_hash;
+    }
+    return match;
+}
+
+bool PatternMatch::TestPawnSpan( bool &reverse, const PawnSpan &span, unsigned short &ply )
+{
+    // Games start with white to move, so white is to move after an even number of plies.
+    //  Try the first ply of the span, then the next in case the side to move is wrong
+    for( int i=span.first_ply; i<=span.last_ply && i<=span.first_ply+1; i++ )
+    {
+        if( TestPawnStructure( reverse, (i&1)==0, span.hash ) )
+        {
+            ply = static_cast<unsigned short>(i);
+            return true;
+        }
+    }
+    return false;
+}
 
 // Pawns for each side are assigned logical numbers from 0 to nbr_pawns-1
 //  The ordering of the numbers is determined by consulting this table...
@@ -561,3 +597,61 @@ bool PatternMatch::TestMaterialBalanceInner( bool &reverse, MpsSide *ws, MpsSide
     }
     return match;
 }
+
+// Is count (from a signature, so saturated at max) possibly equal to (or if more is set,
+//  possibly at least) want
+static bool MaterialCountPossible( int count, int want, int max, bool more )
+{
+    if( want > max )
+        want = max;
+    return more ? count>=want : count==want;
+}
+
+static bool MaterialSidePossible( uint32_t signature, bool white, const MpsSide &side, const PatternParameters &parm )
+{
+    bool more_p = white ? parm.more_pieces_wp : parm.more_pieces_bp;
+    bool more_n = white ? parm.more_pieces_wn : parm.more_pieces_bn;
+    bool more_b = white ? parm.more_pieces_wb : parm.more_pieces_bb;
+    bool more_r = white ? parm.more_pieces_wr : parm.more_pieces_br;
+    bool more_q = white ? parm.more_pieces_wq : parm.more_pieces_bq;
+    int light = MaterialSignatureCount(signature,white,MATERIAL_LIGHT_BISHOPS);
+    int dark  = MaterialSignatureCount(signature,white,MATERIAL_DARK_BISHOPS);
+    bool ok = MaterialCountPossible( MaterialSignatureCount(signature,white,MATERIAL_PAWNS),   side.nbr_pawns,   15, more_p ) &&
+              MaterialCountPossible( MaterialSignatureCount(signature,white,MATERIAL_KNIGHTS), side.nbr_knights, 3, more_n ) &&
+              MaterialCountPossible( MaterialSignatureCount(signature,white,MATERIAL_ROOKS),   side.nbr_rooks,   3, more_r ) &&
+              MaterialCountPossible( MaterialSignatureCount(signature,white,MATERIAL_QUEENS),  side.nbr_queens,  3, more_q );
+    if( ok && parm.bishops_must_be_same_colour )
+    {
+        ok = MaterialCountPossible( light, side.nbr_light_bishops, 3, more_b ) &&
+             MaterialCountPossible( dark,  side.nbr_dark_bishops,  3, more_b );
+    }
+    else if( ok && light<3 && dark<3 )    // a saturated count means we can't tell
+    {
+        ok = MaterialCountPossible( light+dark, side.nbr_light_bishops+side.nbr_dark_bishops, 6, more_b );
+    }
+    return ok;
+}
+
+bool PatternMatch::MaterialSignaturePossible( uint32_t signature )
+{
+    if( !parm.material_balance )
+        return true;
+    for( int test=0; test<reflect_and_reverse; test++ )
+    {
+        PatternMatchTarget *target;
+        switch(test)
+        {
+            default:
+            case 0: target = &target_n;   break;
+            case 1: target = &target_m;   break;
+            case 2: target = &target_r;   break;
+            case 3: target = &target_rm;  break;
+        }
+        if( reflect_and_reverse==3 && test==1 )    // reflect_and_reverse==3 means do i==0 and i==2
+            continue;
+        if( MaterialSidePossible( signature, true,  target->side_w, target->parm ) &&
+            MaterialSidePossible( signature, false, target->side_b, target->parm ) )
+            return true;
+    }
+    return false;
+}
@@ -8,6 +8,7 @@
 #define PATTERN_MATCH_H
 #include "thc.h"
 #include "MemoryPositionSearchSide.h"
+#include "CompressMoves.h"
 
 struct PATTERN_STATS
 {
@@ -17,6 +18,16 @@ struct PATTERN_STATS
     int black_wins;
     int draws;
     PATTERN_STATS() {nbr_games=0; nbr_reversed_games=0; white_wins=0; black_wins=0; draws=0;}
+
+    // Combine the stats from (eg) separate threads searching separate games
+    void Merge( const PATTERN_STATS &other )
+    {
+        nbr_games          += other.nbr_games;
+        nbr_reversed_games += other.nbr_reversed_games;
+        white_wins         += other.white_wins;
+        black_wins         += other.black_wins;
+        draws              += other.draws;
+    }
 };
 
 struct PatternParameters
@@ -26,6 +37,9 @@ struct PatternParameters
     // Type of search (pattern or material balance)
     bool material_balance;
 
+    // Pattern search refinement, match the pawns only (all of them, ignoring pieces)
+    bool pawn_structure;
+
     // Input positon
     thc::ChessPosition cp;
 
@@ -67,6 +81,7 @@ struct PatternParameters
             include_reflections = false;
             include_reverse_colours = false;
             dont_allow_more_pieces = false; //material_balance_?false:true;
+            pawn_structure = false;
             either_to_move = false;
             white_to_move = true;
             pawns_must_be_on_same_files = false;
@@ -107,6 +122,7 @@ struct PatternMatchTarget
     const uint64_t *rank1_target_ptr;
     uint64_t        rank1_mask;
     thc::ChessPosition cp;
+    uint64_t        pawn_hash;
     MpsSide         side_w;
     MpsSide         side_b;
     PatternParameters parm;
@@ -130,6 +146,10 @@ public:
         PrimeMaterialBalance();
     }
 
+    // Material balance search, false if no position with this material signature
+    //  (see CompressMoves.h) can match, so games can be skipped using their index
+    bool MaterialSignaturePossible( uint32_t signature );
+
     // Start of game
     void NewGame() { in_a_row=0; }
 
@@ -142,10 +162,16 @@ public:
     {
         if( parm.material_balance )
             return TestMaterialBalance( reverse, ws, bs, squares_rover, may_need_to_rebuild_side );
+        else if( parm.pawn_structure )     // games without a pawn structure index, see TestPawnSpan()
+            return TestPawnStructure( reverse, white, PawnStructureHash(squares_rover) );
         else
             return TestPattern( reverse, white, squares_rover );
     }
 
+    // Pawn structure search, using a game's pawn structure index instead of testing
+    //  every ply. If the span matches ply is the first matching ply within it
+    bool TestPawnSpan( bool &reverse, const PawnSpan &span, unsigned short &ply );
+
 private:
 
     // Prime
@@ -155,6 +181,7 @@ private:
 
     // Test against criteria
     bool TestPattern( bool &reverse, bool white, const char *squares_rover );
+    bool TestPawnStructure( bool &reverse, bool white, uint64_t pawn_hash );
     bool TestMaterialBalance( bool &reverse, MpsSide *ws, MpsSide *bs, const char *squares_rover, bool may_need_to_rebuild_side );
     bool TestMaterialBalanceInner( bool &reverse, MpsSide *ws, MpsSide *bs, const char *squares_rover, bool may_need_to_rebuild_side );
 
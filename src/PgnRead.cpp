@@ -12,6 +12,7 @@
 #include <stdarg.h>
 #include "thc.h"
 #include "PgnRead.h"
+#include "PgnTokenizer.h"
 #include "DebugPrintf.h"
 #include "fseek64.h"
 
@@ -20,7 +21,7 @@ using namespace thc;
 #define nbrof(array) ( sizeof(array) / sizeof((array)[0]) )
 
 // Constructor
-PgnRead::PgnRead( char callback_code, ProgressBar *pb )
+PgnRead::PgnRead( char callback_code, ProgressBar *pb, int initial_capacity )
 {
     this->callback_code = callback_code;
     this->pb = pb;
@@ -50,7 +51,28 @@ PgnRead::PgnRead( char callback_code, ProgressBar *pb )
     error_ptr = 0;
     debug_ptr = 0;
     stack_idx = 0;
-    memset( stack_array, 0, sizeof(stack_array) );
+    this->initial_capacity = initial_capacity<1 ? 1 : initial_capacity;
+    nbr_allocations = 0;
+    stack_array.resize(1);
+    stack_array[0].state = INIT;
+    stack_array[0].nbr_moves = 0;
+    Reserve( stack_array[0], this->initial_capacity );
+}
+
+// Make sure an arena can hold at least nbr_moves moves (and hashes), grows by doubling
+//  so a long game costs only a handful of allocations, after which it's free
+void PgnRead::Reserve( STACK_ELEMENT &n, int nbr_moves )
+{
+    size_t sz = n.big_move_array.size();
+    if( static_cast<size_t>(nbr_moves) <= sz )
+        return;
+    if( sz < static_cast<size_t>(initial_capacity) )
+        sz = initial_capacity;
+    while( sz < static_cast<size_t>(nbr_moves) )
+        sz *= 2;
+    n.big_move_array.resize(sz);
+    n.big_hash_array.resize(sz);
+    nbr_allocations++;
 }
 
 const char *PgnRead::ShowState( STATE state )
@@ -202,311 +224,74 @@ bool PgnRead::Process( FILE *infile )
 
 void PgnRead::GameParse( std::string &str )
 {
-    char buf[FIELD_BUFLEN+10];
-    static char comment_buf[10000];
-    int ch, comment_ch=0, previous_ch=0, push_back=0, len=0, move_number=0;
-    STATE state=MOVE_NUMBER, old_state, save_state=MOVE_NUMBER;
-    static int nag_value;
-    int input_len = str.length();
-    int idx = 0;
-    if( idx < input_len )
-        ch = str[idx++];
-    else
-        ch = EOF;
-    while( ch != EOF )
+    PgnTokenizer tz( str.c_str(), str.length() );
+    PgnToken tok;
+    int move_number=0;
+    STATE state=BETWEEN_MOVES;
+    while( tz.Next(tok) )
     {
-        if( push_back == '\0' )
+
+        // Keep the simple debug mechanism going, a token at a time
+        for( size_t i=tok.offset; i<tok.end; i++ )
         {
-            error_buf[error_ptr++] = (char)ch;
+            error_buf[error_ptr++] = str[i];
             error_ptr &= (sizeof(error_buf)-1);
         }
-        push_back = '\0';
-
-        debug_buf[debug_ptr].c     = (char)ch;
+        debug_buf[debug_ptr].c     = str[tok.offset];
         debug_buf[debug_ptr].state = state;
         debug_ptr++;
         debug_ptr &= (nbrof(debug_buf)-1);
 
-        // State machine
-        old_state = state;
-        if( ch == '{' && (
-                                state!=IN_COMMENT &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                            )
-            )
-        {
-            save_state = state;
-            comment_ch = '{';
-            state = IN_COMMENT;
-        }
-        else if( ch == ';' && (
-                                state!=IN_COMMENT &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                                )
-                )
-        {
-            save_state = state;
-            comment_ch = ';';
-            state = IN_COMMENT;
-        }
-        else if( state==IN_COMMENT &&
-                    (
-                        (comment_ch=='{' && ch=='}') ||
-                        (comment_ch==';' && ch!=';' && previous_ch=='\n')
-                    )
-                )
-        {
-            if( comment_ch == ';' )
-                push_back = ch;
-            comment_buf[len] = '\0';
-
-            // Added the following to fix an ugly bug we were going IN_DOLLAR->IN_COMMENT then back to IN_DOLLAR
-            //  and never escaping from IN_DOLLAR because save_state was IN_DOLLAR. Yuk. Maybe we should adopt
-            //  the main tarrasch pgn parser practice of only going to IN_COMMENT and IN_DOLLAR from BETWEEN_MOVES
-            state = ((save_state==IN_DOLLAR||save_state==MOVE_NUMBER)?BETWEEN_MOVES:save_state);
-        }
-        else if( ch == '$' && (
-                                state!=IN_COMMENT &&
-                                state!=IN_DOLLAR &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                            )
-            )
+        switch( tok.type )
         {
-            save_state = state;
-            state = IN_DOLLAR;
-            nag_value = 0;
-        }
-        else if( state==IN_DOLLAR && isascii(ch) && isdigit(ch) )
-        {
-            nag_value = nag_value*10+(ch-'0');
-        }
-        else if( state==IN_DOLLAR && isascii(ch) && !isdigit(ch) )
-        {
-        /*  const char *nag_array[] =
+            default: break;     // comments, NAGs, !? etc. are of no interest
+            case PGN_TOKEN_RESULT:
             {
-                "",
-                " !",     // $1
-                " ?",     // $2
-                " !!",    // $3
-                " ??",    // $4
-                " !?",    // $5
-                " ?!",    // $6
-                "",       // $7
-                "",       // $8
-                " ??",    // $9
-                " =",     // $10
-                " =",     // $11
-                " =",     // $12
-                "",       // $13
-                " +=",    // $14
-                " =+",    // $15
-                " +/-",   // $16
-                " -/+",   // $17
-                " +-",    // $18
-                " -+",    // $19
-                " +-",    // $20
-                " -+"     // $21
-            };   */
-            push_back = ch;
-
-            // Added the following to fix an ugly bug we were going IN_DOLLAR->IN_COMMENT then back to IN_DOLLAR
-            //  and never escaping from IN_DOLLAR because save_state was IN_DOLLAR. Yuk. Maybe we should adopt
-            //  the main tarrasch pgn parser practice of only going to IN_COMMENT and IN_DOLLAR from BETWEEN_MOVES
-            state = (save_state==IN_COMMENT?BETWEEN_MOVES:save_state);
-        }
-        else if( ch == '(' && (
-                                state!=IN_COMMENT    &&
-                                state!=ERROR_STATE   &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                                )
-                )
-            state = Push(state);
-        else if( ch == ')' && (
-                                state!=IN_COMMENT &&
-                                state!=ERROR_STATE      &&
-                                state!=IN_MOVE_BLACK &&
-                                state!=IN_MOVE_WHITE
-                                )
-                )
-        {
-            state = Pop();
-        }
-        else
-        {
-
-            switch( state )
+                return;
+            }
+            case PGN_TOKEN_MOVE_NUMBER:
             {
-                default: break;
-                case IN_COMMENT:
-                {
-                    if( len < sizeof(comment_buf)-3 )
-                    {
-                        if( comment_ch == '{' )
-                            comment_buf[len++] = (char)ch;
-                        else
-                        {
-                            if( ch!=';' || (previous_ch!='\n' || previous_ch!='\r') )
-                                comment_buf[len++] = (char)ch;
-                        }
-                    }
-                    break;
-                }
-
-                case MOVE_NUMBER:
-                {
-                    if( ch=='.' || ch==' ' || ch=='\t' || ch=='\n' || ch=='\r' )
-                    {
-                        buf[len] = '\0';
-                        len = 0;
-                        if( TestResult(buf) )
-                            state = NORMAL_EXIT;
-                        else if( (move_number=atoi(buf)) > 0 )
-                        {
-                            state = POST_MOVE_NUMBER;
-                            if( ch == '.' )
-                                push_back = ch;
-                        }
-                        else
-                        {
-                            Error( "Bad move number" );
-                            cprintf( "debugging 1: %s\n", str.c_str( ));
-                            state = ERROR_STATE;
-                        }
-                    }
-                    else
-                    {
-                        if( len < FIELD_BUFLEN )
-                            buf[len++] = (char)ch;
-                        else
-                        {
-                            Error( "Internal buffer overflow" );
-                            state = ERROR_STATE;
-                        }
-                    }
-                    break;
-                }
-
-                case POST_MOVE_NUMBER:
+                move_number = tok.value;
+                if( move_number <= 0 )
                 {
-                    if( ch == '.' )
-                        state = POST_MOVE_NUMBER_HAVE_PERIOD;
-                    else if( ch!=' ' && ch!='\t' && ch!='\n'  && ch!='\r' )
-                    {
-                        Error( "Bad move number" );
-                        cprintf( "debugging 1: %s\n", str.c_str( ));
-                        state = ERROR_STATE;
-                    }
-                    break;
+                    Error( "Bad move number" );
+                    cprintf( "debugging 1: %s\n", str.c_str( ));
+                    return;
                 }
-
-                case POST_MOVE_NUMBER_HAVE_PERIOD:
+                state = (tok.black ? PRE_MOVE_BLACK : PRE_MOVE_WHITE);
+                break;
+            }
+            case PGN_TOKEN_SAN:
+            {
+                if( state==BETWEEN_MOVES && move_number>0 )
                 {
-                    if( ch == '.' )
-                        state = POST_MOVE_NUMBER_BLACK;
-                    else
-                    {
-                        push_back = ch;
-                        state = PRE_MOVE_WHITE;
-                    }
-                    break;
+                    move_number++;      // white move without a move number
+                    state = PRE_MOVE_WHITE;
                 }
-
-                case POST_MOVE_NUMBER_BLACK:
-                {
-                    if( ch != '.' )
-                    {
-                        push_back = ch;
-                        state = PRE_MOVE_BLACK;
-                    }
+                if( state!=PRE_MOVE_WHITE && state!=PRE_MOVE_BLACK )
                     break;
-                }
-
-                case PRE_MOVE_WHITE:
-                case PRE_MOVE_BLACK:
+                if( !DoMove(state==PRE_MOVE_WHITE,move_number,tok.txt) )
                 {
-                    if( isascii(ch) && isdigit(ch) )
-                    {
-                        push_back = ch;
-                        state = MOVE_NUMBER;
-                    }
-                    else if( ch!=' ' && ch!='\t' && ch!='\n'  && ch!='\r' )
-                    {
-                        push_back = ch;
-                        state = (state==PRE_MOVE_WHITE?IN_MOVE_WHITE:IN_MOVE_BLACK);
-                    }
-                    break;
-                }
-
-                case IN_MOVE_WHITE:
-                case IN_MOVE_BLACK:
-                {
-                    if( ch==' ' || ch=='\t' || ch=='\r' || ch=='\n' || ch=='(' || ch==')' || ch=='{' || ch=='}' || ch=='$' )
-                    {
-                        buf[len] = '\0';
-                        len = 0;
-                        if( TestResult(buf) )
-                            state = PREFIX;
-                        else if( !DoMove(state==IN_MOVE_WHITE,move_number,buf) )
-                        {
-                            cprintf( "debugging 3: %s\n", str.c_str( ));
-                            state = ERROR_STATE;
-                        }
-                        else
-                            state = (state==IN_MOVE_WHITE?PRE_MOVE_BLACK:BETWEEN_MOVES);
-                        if( ch=='(' || ch==')' || ch=='{' || ch=='}' || ch=='?' )
-                            push_back = ch;
-                    }
-                    else
-                    {
-                        if( len < FIELD_BUFLEN )
-                            buf[len++] = (char)ch;
-                        else
-                        {
-                            Error( "Internal buffer overflow" );
-                            state = ERROR_STATE;
-                        }
-                    }
-                    break;
-                }
-
-                case BETWEEN_MOVES:
-                {
-                    if( isascii(ch) && isdigit(ch) )
-                    {
-                        push_back = ch;
-                        state = MOVE_NUMBER;
-                    }
-                    break;
+                    cprintf( "debugging 3: %s\n", str.c_str( ));
+                    return;
                 }
+                state = (state==PRE_MOVE_WHITE?PRE_MOVE_BLACK:BETWEEN_MOVES);
+                break;
+            }
+            case PGN_TOKEN_VARIATION_START:
+            {
+                stack_array[stack_idx].move_number = move_number;
+                state = Push(state);
+                break;
+            }
+            case PGN_TOKEN_VARIATION_END:
+            {
+                state = Pop();
+                if( state == ERROR_STATE )
+                    return;
+                move_number = stack_array[stack_idx].move_number;
+                break;
             }
-        }
-
-        if( state==NORMAL_EXIT || state==ERROR_STATE )
-            return;
-
-        // State changes
-        if( state != old_state )
-        {
-            if( state==IN_COMMENT || state==MOVE_NUMBER || state==IN_MOVE_WHITE || state==IN_MOVE_BLACK )
-                len=0;
-        }
-
-        // Next character
-        previous_ch = ch;
-        if( push_back )
-            ch = push_back;
-        else
-        {
-            do {
-                if( idx < input_len )
-                    ch = str[idx++];
-                else
-                    ch = EOF;
-            } while ( ch == '\r' );
         }
     }
 }
@@ -1103,7 +888,7 @@ bool PgnRead::GameOver()
         STACK_ELEMENT *s;
         s = &stack_array[0];
         const char *pfen = (fen_flag && fen[0]) ? fen : NULL;
-        aborted = hook_gameover( callback_code, pfen, event, site, date, round, white, black, result, white_elo, black_elo, eco, s->nbr_moves, s->big_move_array, s->big_hash_array  );
+        aborted = hook_gameover( callback_code, pfen, event, site, date, round, white, black, result, white_elo, black_elo, eco, s->nbr_moves, &s->big_move_array[0], &s->big_hash_array[0]  );
         stack_idx = 0;
         thc::ChessRules temp;
         chess_rules = temp;    // init
@@ -1118,13 +903,20 @@ bool PgnRead::GameOver()
 PgnRead::STATE PgnRead::Push( PgnRead::STATE in )
 {
     STACK_ELEMENT *s, *n;
+    if( static_cast<size_t>(stack_idx+1) >= stack_array.size() )
+    {
+        stack_array.resize( stack_idx+2 );      // deeper nesting than ever before
+        nbr_allocations++;
+    }
     s = &stack_array[stack_idx];
     stack_idx++;
     n = &stack_array[stack_idx];
     s->state     = in;
     s->position  = chess_rules;
+    Reserve( *n, s->nbr_moves+1 );
     n->nbr_moves = s->nbr_moves;
-    memcpy( n->big_move_array, s->big_move_array, s->nbr_moves*sizeof(thc::Move) );
+    if( s->nbr_moves > 0 )
+        memcpy( &n->big_move_array[0], &s->big_move_array[0], s->nbr_moves*sizeof(thc::Move) );
     return BETWEEN_MOVES;
 }
 
@@ -1146,7 +938,7 @@ PgnRead::STATE PgnRead::Pop()
 
 void PgnRead::FileOver()
 {
-    cprintf( "Finished %d total games\n", nbr_games-1 );
+    cprintf( "Finished %d total games, %u arena allocations\n", nbr_games-1, nbr_allocations );
 }
 
 
@@ -1182,7 +974,7 @@ void PgnRead::Error( const char *msg )
 }
 
 
-bool PgnRead::DoMove( bool white_, int move_number, char *buf )
+bool PgnRead::DoMove( bool white_, int move_number, const char *buf )
 {
     //FILE *debug=debug_log_file();
     //fprintf( debug, "** DoMove( white=%s, move_number=%d, buf=%s)\n", white_?"true":"false", move_number, buf );
@@ -1303,13 +1095,9 @@ bool PgnRead::DoMove( bool white_, int move_number, char *buf )
             {
                 cprintf( "hit: hash=0x%08x, mega_array[hash]=%d\n", hash, mega_array[hash] );
             } */
+            Reserve( *n, n->nbr_moves+1 );
             n->big_move_array[n->nbr_moves] = move;
             n->big_hash_array[n->nbr_moves++] = hash;
-            if( n->nbr_moves == nbrof(n->big_move_array)-3 )
-            {
-                Error( "Game too big" );
-                okay = false;
-            }
             //if( nbr_games == 1 )
             //{
             //   cprintf( "%s\n", chess_rules.ToDebugStr().c_str() );
@@ -12,6 +12,7 @@
 #include "ProgressBar.h"
 
 #define FIELD_BUFLEN 200
+#define PGN_READ_INITIAL_CAPACITY 256  // ply, per variation level, grows as needed
 
 // Callback
 bool hook_gameover( char callback_code, const char *fen, const char *event, const char *site, const char *date, const char *round,
@@ -24,10 +25,14 @@ class PgnRead
 public:
 
     // Constructor
-    PgnRead( char callback_code, ProgressBar *pb=0 );
+    PgnRead( char callback_code, ProgressBar *pb=0, int initial_capacity=PGN_READ_INITIAL_CAPACITY );
 
     bool Process( FILE *infile );
 
+    // Number of times the move/hash arenas have had to grow, once they are big
+    //  enough for the longest game seen so far this stays put
+    unsigned int NbrAllocations() const { return nbr_allocations; }
+
 private:
     char callback_code;
     ProgressBar *pb;
@@ -95,19 +100,24 @@ private:
     char debug_ptr;
     void debug_dump();
 
-    // Stackable line = position + moves
+    // Stackable line = position + moves. The move and hash arrays are arenas that
+    //  grow as needed and keep their capacity from game to game
     struct STACK_ELEMENT
     {
         STATE                   state;
         thc::ChessPosition      position;
+        int                     move_number;
         int                     nbr_moves;
-        thc::Move               big_move_array[1000];
-        uint64_t                big_hash_array[1000];
+        std::vector<thc::Move>  big_move_array;
+        std::vector<uint64_t>   big_hash_array;
     };
 
-    // Up to 20 levels deep
-    STACK_ELEMENT stack_array[20];
+    // One element per level of variation nesting, grows as needed
+    std::vector<STACK_ELEMENT> stack_array;
     int stack_idx;
+    int initial_capacity;
+    unsigned int nbr_allocations;
+    void Reserve( STACK_ELEMENT &n, int nbr_moves );
 
     // Misc helpers
     FILE *debug_log_file();
@@ -116,7 +126,7 @@ private:
     STATE Push( STATE in );
     STATE Pop();
     void Header( char *buf );
-    bool DoMove( bool white, int move_number, char *buf );
+    bool DoMove( bool white, int move_number, const char *buf );
     void GameBegin();
     void GameParse( std::string &str );
     bool GameOver();
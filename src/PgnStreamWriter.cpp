@@ -0,0 +1,331 @@
+/****************************************************************************
+ * Stream PGN text to a file through large reusable buffers, with the actual
+ *  disk writes done by a background thread
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include "CompressMoves.h"
+#include "ListableGame.h"
+#include "PgnStreamWriter.h"
+#include "fseek64.h"
+#ifdef THC_LINUX
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/sendfile.h>
+#endif
+
+#ifdef _WINDOWS
+#define EOL "\r\n"
+#else
+#define EOL "\n"
+#endif
+
+PgnStreamWriter::PgnStreamWriter( FILE *pgn_out, size_t block_size )
+{
+    this->pgn_out = pgn_out;
+    this->block_size = block_size;
+    posn = 0;
+    writing = false;
+    finishing = false;
+    finished = false;
+    failed = false;
+    block.reserve( block_size + block_size/8 );    // a little headroom, we only check fullness between games
+    writer = std::thread( &PgnStreamWriter::WriterThread, this );
+}
+
+PgnStreamWriter::~PgnStreamWriter()
+{
+    Finish();
+}
+
+void PgnStreamWriter::Write( const char *txt, size_t len )
+{
+    block.append( txt, len );
+    posn += len;
+    if( block.length() >= block_size )
+        Handoff( false );
+}
+
+void PgnStreamWriter::WriteTags( const Roster &r )
+{
+    size_t len_before = block.length();
+    PgnTagsFormat( r, r.fen, NULL, block );
+    posn += (block.length() - len_before);
+}
+
+void PgnTagsFormat( const Roster &r, const std::string &fen,
+                    const std::vector< std::pair<std::string,std::string> > *extra_tags, std::string &out )
+{
+    out += "[Event \"";
+    out += (r.event=="" ? "?" : r.event);
+    out += "\"]" EOL "[Site \"";
+    out += (r.site=="" ? "?" : r.site);
+    out += "\"]" EOL "[Date \"";
+    out += (r.date=="" ? "????.??.??" : r.date);
+    out += "\"]" EOL "[Round \"";
+    out += (r.round=="" ? "?": r.round);
+    out += "\"]" EOL "[White \"";
+    out += (r.white=="" ? "?": r.white);
+    out += "\"]" EOL "[Black \"";
+    out += (r.black=="" ? "?": r.black);
+    out += "\"]" EOL "[Result \"";
+    out += (r.result=="" ? "*" : r.result);
+    out += "\"]" EOL;
+    if( r.white_elo != "" )
+    {
+        out += "[WhiteElo \"";
+        out += r.white_elo;
+        out += "\"]" EOL;
+    }
+    if( r.black_elo != "" )
+    {
+        out += "[BlackElo \"";
+        out += r.black_elo;
+        out += "\"]" EOL;
+    }
+    if( r.eco != "" )
+    {
+        out += "[ECO \"";
+        out += r.eco;
+        out += "\"]" EOL;
+    }
+    if( fen != "" )
+    {
+        out += "[FEN \"";
+        out += fen;
+        out += "\"]" EOL;
+    }
+    if( extra_tags )
+    {
+        for( const std::pair<std::string,std::string> &key_value: *extra_tags )
+        {
+            out += "[";
+            out += key_value.first;     // key
+            out += " \"";
+            out += key_value.second;    // value
+            out += "\"]" EOL;
+        }
+    }
+    out += EOL;
+}
+
+void PgnStreamWriter::FormatGame( const Roster &r, const char *blob, size_t len, std::string &out )
+{
+    PgnTagsFormat( r, r.fen, NULL, out );
+    CompressMoves comp;
+    comp.ToNaturalMoves( blob, len, r.result=="" ? "*" : r.result, out );
+    out += EOL;
+}
+
+bool PgnStreamWriter::WriteGame( ListableGame *mptr )
+{
+    if( mptr->IsGameDocument() )
+        return false;   // might have comments, variations etc.
+    Roster &r = mptr->RefRoster();
+    if( r.fen != "" )
+        return false;   // blob decoding assumes the standard starting position
+    const char *blob = mptr->CompressedMoves();
+    if( !blob )
+        return false;
+    size_t len_before = block.length();
+    FormatGame( r, blob, strlen(blob), block );
+    posn += (block.length() - len_before);
+    if( block.length() >= block_size )
+        Handoff( false );
+    return true;
+}
+
+bool PgnStreamWriter::CopyRange( FILE *pgn_in, int64_t start, int64_t len )
+{
+    if( 0!=fseek64(pgn_in,0,SEEK_END) || ftell64(pgn_in)<start+len )
+        return false;
+    int64_t done = 0;
+    if( len >= PGN_STREAM_KERNEL_COPY )
+        done = KernelCopy( pgn_in, start, len );
+
+    // The rest goes through the buffer a block at a time, a long run of games mustn't
+    //  be read into memory all at once
+    if( done<len && 0!=fseek64(pgn_in,start+done,SEEK_SET) )
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if( done > 0 )
+            failed = true;
+        return false;
+    }
+    while( done < len )
+    {
+        size_t len_before = block.length();
+        size_t room = len_before<block_size ? block_size-len_before : 0;
+        if( room == 0 )
+        {
+            Handoff( false );
+            continue;
+        }
+        size_t n = static_cast<size_t>( std::min<int64_t>( len-done, room ) );
+        block.resize( len_before + n );
+        size_t got = fread( &block[len_before], 1, n, pgn_in );
+        block.resize( len_before + got );
+        posn += got;
+        done += got;
+        if( got != n )
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            failed = true;  // a read error part way, unusual
+            return false;
+        }
+        if( block.length() >= block_size )
+            Handoff( false );
+    }
+    return true;
+}
+
+// Copy a range from file to file without it passing through user space. Everything
+//  buffered so far must reach the file first, so this only pays off for big ranges
+//  (typically a long run of unmodified games). Returns the number of bytes copied,
+//  the caller copies the rest (if any) the ordinary way
+int64_t PgnStreamWriter::KernelCopy( FILE *pgn_in, int64_t start, int64_t len )
+{
+#ifndef THC_LINUX
+    return 0;
+#else
+    int fd_in  = fileno(pgn_in);
+    int fd_out = fileno(pgn_out);
+    struct stat st;
+    if( fstat(fd_in,&st)!=0 || st.st_size < start+len )
+        return 0;
+    Drain();
+    fflush( pgn_out );
+    off_t off_in = start;
+    int64_t remaining = len;
+    bool use_sendfile = false;
+    while( remaining > 0 )
+    {
+        ssize_t n;
+        if( use_sendfile )
+            n = sendfile( fd_out, fd_in, &off_in, static_cast<size_t>(remaining) );
+        else
+        {
+            n = copy_file_range( fd_in, &off_in, fd_out, NULL, static_cast<size_t>(remaining), 0 );
+            if( n<0 && (errno==EXDEV || errno==ENOSYS || errno==EINVAL || errno==EOPNOTSUPP) )
+            {
+                use_sendfile = true;    // eg. different filesystems, or an old kernel
+                continue;
+            }
+        }
+        if( n <= 0 )
+            break;
+        remaining -= n;
+    }
+
+    // The descriptor's offset moved behind stdio's back, resync (we only ever append)
+    fseek64( pgn_out, 0, SEEK_END );
+    int64_t copied = len-remaining;
+    posn += copied;
+    return copied;
+#endif
+}
+
+void PgnStreamFormatParallel( std::vector<PgnStreamJob> &jobs, int nbr_jobs )
+{
+    int nbr_threads = std::thread::hardware_concurrency();
+    if( nbr_threads > nbr_jobs/64 )     // not worth a thread for just a few games
+        nbr_threads = nbr_jobs/64;
+    if( nbr_threads < 1 )
+        nbr_threads = 1;
+    std::atomic<int> next(0);
+    auto worker = [&jobs,&next,nbr_jobs]()
+    {
+        for(;;)
+        {
+            int idx = next++;
+            if( idx >= nbr_jobs )
+                break;
+            PgnStreamJob &job = jobs[idx];
+            job.txt.clear();
+            PgnStreamWriter::FormatGame( job.r, job.blob.c_str(), job.blob.length(), job.txt );
+        }
+    };
+    std::vector<std::thread> pool;
+    for( int i=1; i<nbr_threads; i++ )
+        pool.push_back( std::thread(worker) );
+    worker();   // this thread does its share too
+    for( std::thread &t: pool )
+        t.join();
+}
+
+// Queue the current block for the writer thread and start filling a (recycled) fresh one
+void PgnStreamWriter::Handoff( bool force )
+{
+    if( block.length()==0 && !force )
+        return;
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait( lock, [this]{ return queue.size() < PGN_STREAM_MAX_BLOCKS; } );
+    queue.push_back( std::move(block) );
+    if( spares.size() > 0 )
+    {
+        block = std::move( spares.back() );
+        spares.pop_back();
+        block.clear();
+    }
+    else
+    {
+        block = std::string();
+        block.reserve( block_size + block_size/8 );
+    }
+    cv.notify_all();
+}
+
+// Hand over the current block and wait until the writer thread has written everything
+void PgnStreamWriter::Drain()
+{
+    if( block.length() > 0 )
+        Handoff( true );
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait( lock, [this]{ return queue.size()==0 && !writing; } );
+}
+
+void PgnStreamWriter::WriterThread()
+{
+    for(;;)
+    {
+        std::string out;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait( lock, [this]{ return queue.size()>0 || finishing; } );
+            if( queue.size() == 0 )
+                break;  // finishing and nothing left to write
+            out = std::move( queue.front() );
+            queue.pop_front();
+            writing = true;
+        }
+        size_t written = fwrite( out.c_str(), 1, out.length(), pgn_out );
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            if( written != out.length() )
+                failed = true;
+            spares.push_back( std::move(out) );
+            writing = false;
+            cv.notify_all();
+        }
+    }
+}
+
+void PgnStreamWriter::Finish()
+{
+    if( finished )
+        return;
+    if( block.length() > 0 )
+        Handoff( true );
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        finishing = true;
+        cv.notify_all();
+    }
+    writer.join();
+    finished = true;
+}
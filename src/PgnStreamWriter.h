@@ -0,0 +1,103 @@
+/****************************************************************************
+ * Stream PGN text to a file through large reusable buffers, with the actual
+ *  disk writes done by a background thread
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef PGN_STREAM_WRITER_H
+#define PGN_STREAM_WRITER_H
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <utility>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "Roster.h"
+
+#define PGN_STREAM_BLOCK_SIZE   (4*1024*1024)   // hand a block to the writer when it's this full
+#define PGN_STREAM_MAX_BLOCKS   4               // blocks in flight, bounds memory use
+#define PGN_STREAM_BATCH        4096            // games formatted in parallel at a time
+#define PGN_STREAM_KERNEL_COPY  (1024*1024)     // ranges this big are copied file to file by the OS
+
+// A game waiting to be formatted by PgnStreamFormatParallel()
+struct PgnStreamJob
+{
+    Roster      r;
+    std::string blob;
+    std::string txt;
+};
+
+// Format jobs[0] to jobs[nbr_jobs-1] on all available cores, each into its own txt
+void PgnStreamFormatParallel( std::vector<PgnStreamJob> &jobs, int nbr_jobs );
+
+// Append the PGN tag section of a game (the seven tag roster, Elos and ECO if known, FEN
+//  if not empty, then any extra tags) to out. Every PGN save path formats tags with this
+void PgnTagsFormat( const Roster &r, const std::string &fen,
+                    const std::vector< std::pair<std::string,std::string> > *extra_tags, std::string &out );
+
+class ListableGame;
+class PgnStreamWriter
+{
+public:
+    PgnStreamWriter( FILE *pgn_out, size_t block_size=PGN_STREAM_BLOCK_SIZE );
+    ~PgnStreamWriter();     // calls Finish()
+
+    // Append raw text
+    void Write( const char *txt, size_t len );
+    void Write( const char *txt ) { Write( txt, strlen(txt) ); }
+    void Write( const std::string &s ) { Write( s.c_str(), s.length() ); }
+
+    // Append the tag section of a game, see PgnTagsFormat()
+    void WriteTags( const Roster &r );
+
+    // Format a game from its compressed moves, tags and all (appends to out)
+    static void FormatGame( const Roster &r, const char *blob, size_t len, std::string &out );
+
+    // Append bytes start to start+len-1 of a file verbatim, returns false (and writes
+    //  nothing) if they aren't all in the file. Big ranges go straight from file to file
+    //  (copy_file_range() or sendfile() on Linux) without passing through our buffers,
+    //  otherwise they're copied a block at a time. Also returns false if the copy fails
+    //  part way, in which case Failed() is set and the output is incomplete
+    bool CopyRange( FILE *pgn_in, int64_t start, int64_t len );
+
+    // Append a complete game straight from its compressed moves, no GameDocument
+    //  or MoveTree is built. Returns false (and writes nothing) if the game can't
+    //  be streamed this way (eg it doesn't start from the standard position)
+    bool WriteGame( ListableGame *mptr );
+
+    // File position of the next byte to be written
+    int64_t Posn() const { return posn; }
+
+    // Hand over the last partial block and wait until everything is on disk
+    void Finish();
+
+    // Something couldn't be read or written, the output is incomplete. Only final
+    //  after Finish()
+    bool Failed() { std::unique_lock<std::mutex> lock(mtx); return failed; }
+
+private:
+    void Handoff( bool force );
+    void Drain();
+    int64_t KernelCopy( FILE *pgn_in, int64_t start, int64_t len );
+    void WriterThread();
+    FILE        *pgn_out;
+    size_t      block_size;
+    int64_t     posn;
+    std::string block;                  // block currently being filled
+    std::deque<std::string> queue;      // full blocks waiting to be written
+    std::vector<std::string> spares;    // written blocks, kept for reuse
+    std::mutex  mtx;
+    std::condition_variable cv;
+    bool        writing;                // writer thread is busy with a block
+    bool        finishing;
+    bool        finished;
+    bool        failed;
+    std::thread writer;
+};
+
+#endif // PGN_STREAM_WRITER_H
@@ -0,0 +1,374 @@
+/****************************************************************************
+ * Split PGN text into tokens (tags, move numbers, SAN moves, comments,
+ *  NAGs, variations and results) with a single table driven scanner
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <string.h>
+#include "PgnTokenizer.h"
+#include "fseek64.h"
+#ifdef THC_UNIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Character classes
+#define CC_SPACE    0x01
+#define CC_DIGIT    0x02
+#define CC_ALPHA    0x04
+#define CC_SAN      0x08    // can appear in a move
+#define CC_GLYPH    0x10    // can appear in punctuation like !?, +/- or ...
+#define CC_HIGH     0x20    // not ASCII, start of a UTF-8 sequence (or an ANSI character)
+
+static struct PgnCharClass
+{
+    unsigned char cc[256];
+    PgnCharClass()
+    {
+        memset( cc, 0, sizeof(cc) );
+        for( const char *s=" \t\r\n\f\v"; *s; s++ )
+            cc[static_cast<unsigned char>(*s)] = CC_SPACE;
+        for( int c='0'; c<='9'; c++ )
+            cc[c] = CC_DIGIT|CC_SAN;
+        for( int c='a'; c<='z'; c++ )
+            cc[c] = cc[c-'a'+'A'] = CC_ALPHA|CC_SAN;
+        for( const char *s="=+#-"; *s; s++ )
+            cc[static_cast<unsigned char>(*s)] |= CC_SAN;
+        for( const char *s=".?!+-=/~"; *s; s++ )
+            cc[static_cast<unsigned char>(*s)] |= CC_GLYPH;
+        for( int c=0x80; c<=0xff; c++ )
+            cc[c] = CC_HIGH;
+    }
+} pgn_char_class;
+
+static inline unsigned char Class( char c )
+{
+    return pgn_char_class.cc[ static_cast<unsigned char>(c) ];
+}
+
+PgnTokenizer::PgnTokenizer( const char *buf, size_t len, bool use_semi, bool tags )
+{
+    this->buf = buf;
+    this->len = len;
+    this->use_semi = use_semi;
+    this->tags = tags;
+    p = buf;
+    end = buf+len;
+    if( len>=3 && 0==memcmp(buf,"\xef\xbb\xbf",3) )
+        p += 3;     // UTF-8 BOM, ChessBase does this sometimes
+    text[0] = '\0';
+}
+
+// Decode a non-ASCII character in move text. Returns its length in bytes, and sets
+//  ascii to the ASCII character it stands for, or '\0' if it doesn't stand for one
+int PgnTokenizer::Utf8( const unsigned char *s, char &ascii )
+{
+    size_t avail = end - reinterpret_cast<const char *>(s);
+    ascii = '\0';
+    if( s[0]==0x96 || s[0]==0x97 )          // ANSI en dash or em dash, sometimes used instead of '-'
+    {
+        ascii = '-';
+        return 1;
+    }
+    int n = 1;
+    if( (s[0]&0xe0) == 0xc0 )
+        n = 2;
+    else if( (s[0]&0xf0) == 0xe0 )
+        n = 3;
+    else if( (s[0]&0xf8) == 0xf0 )
+        n = 4;
+    if( static_cast<size_t>(n) > avail )
+        return static_cast<int>(avail);
+    for( int i=1; i<n; i++ )
+    {
+        if( (s[i]&0xc0) != 0x80 )
+            return 1;       // not UTF-8 after all, treat as one 8 bit character
+    }
+    if( n == 2 )
+    {
+        if( s[0]==0xc2 && s[1]==0xa0 )      // no-break space
+            ascii = ' ';
+        else if( s[0]==0xc3 && s[1]==0x97 ) // multiplication sign, for captures
+            ascii = 'x';
+    }
+    else if( n == 3 )
+    {
+        if( s[0]==0xe2 && s[1]==0x80 && (s[2]==0x93 || s[2]==0x94) )    // en dash, em dash
+            ascii = '-';
+        else if( s[0]==0xe2 && s[1]==0x88 && s[2]==0x92 )               // minus sign
+            ascii = '-';
+        else if( s[0]==0xe2 && s[1]==0x99 && 0x94<=s[2] && s[2]<=0x9f ) // chess figurines
+            ascii = "KQRBNP"[ (s[2]-0x94) % 6 ];
+        else if( s[0]==0xef && s[1]==0xbb && s[2]==0xbf )               // stray BOM
+            ascii = ' ';
+    }
+    return n;
+}
+
+// Length of the character at q, and the ASCII character it stands for ('\0' if none)
+#define PEEK(q,ascii)  ( (Class(*(q))&CC_HIGH) ? Utf8(reinterpret_cast<const unsigned char *>(q),ascii) : ((ascii)=*(q),1) )
+
+bool PgnTokenizer::Next( PgnToken &tok )
+{
+    // Skip white space, including the odd non-ASCII space
+    for(;;)
+    {
+        while( p<end && (Class(*p)&CC_SPACE) )
+            p++;
+        char a;
+        if( p<end && (Class(*p)&CC_HIGH) )
+        {
+            int n = Utf8( reinterpret_cast<const unsigned char *>(p), a );
+            if( a == ' ' )
+            {
+                p += n;
+                continue;
+            }
+        }
+        break;
+    }
+    tok.offset = Offset();
+    tok.txt    = text;
+    tok.len    = 0;
+    tok.value  = 0;
+    tok.black  = false;
+    tok.comment_ch = '\0';
+    text[0] = '\0';
+    if( p >= end )
+    {
+        tok.type = PGN_TOKEN_END;
+        tok.end  = tok.offset;
+        return false;
+    }
+    const char *q;
+    char c = *p;
+    char a;
+    int n;
+    if( c == '{' )
+    {
+        p++;
+        q = static_cast<const char *>( memchr( p, '}', end-p ) );
+        tok.type = PGN_TOKEN_COMMENT;
+        tok.comment_ch = '{';
+        tok.txt  = p;
+        tok.len  = static_cast<int>( (q?q:end) - p );
+        p = q ? q+1 : end;
+    }
+    else if( c==';' && use_semi )
+    {
+        p++;
+        q = static_cast<const char *>( memchr( p, '\n', end-p ) );
+        tok.type = PGN_TOKEN_COMMENT;
+        tok.comment_ch = ';';
+        tok.txt  = p;
+        tok.len  = static_cast<int>( (q?q:end) - p );
+        if( tok.len>0 && p[tok.len-1]=='\r' )
+            tok.len--;
+        p = q ? q+1 : end;
+    }
+    else if( c == '(' )
+    {
+        p++;
+        tok.type = PGN_TOKEN_VARIATION_START;
+    }
+    else if( c == ')' )
+    {
+        p++;
+        tok.type = PGN_TOKEN_VARIATION_END;
+    }
+    else if( c == '$' )
+    {
+        p++;
+        while( p<end && (Class(*p)&CC_DIGIT) )
+            tok.value = tok.value*10 + (*p++ - '0');
+        tok.type = PGN_TOKEN_NAG;
+    }
+    else if( c=='[' && tags )
+    {
+        bool in_quotes = false;
+        for( q=p+1; q<end && *q!='\n'; q++ )
+        {
+            if( *q=='\\' && in_quotes && q+1<end )
+                q++;
+            else if( *q == '"' )
+                in_quotes = !in_quotes;
+            else if( *q==']' && !in_quotes )
+            {
+                q++;
+                break;
+            }
+        }
+        tok.type = PGN_TOKEN_TAG;
+        tok.txt  = p;
+        tok.len  = static_cast<int>(q-p);
+        p = q;
+    }
+    else if( c == '*' )
+    {
+        p++;
+        text[tok.len++] = '*';
+        tok.type = PGN_TOKEN_RESULT;
+    }
+
+    // Move number, result, or castling with zeros
+    else if( Class(c) & CC_DIGIT )
+    {
+        q = p;
+        while( q<end && (Class(*q)&CC_DIGIT) )
+        {
+            if( tok.len < PGN_TOKEN_MAXLEN )
+                text[tok.len++] = *q;
+            tok.value = tok.value*10 + (*q++ - '0');
+        }
+        a = '\0';
+        n = (q<end ? PEEK(q,a) : 0);
+        if( a=='-' || a=='/' )
+        {
+            while( q < end )
+            {
+                n = PEEK(q,a);
+                if( !(Class(a)&CC_DIGIT) && a!='-' && a!='/' && a!='+' && a!='#' )
+                    break;
+                if( tok.len < PGN_TOKEN_MAXLEN )
+                    text[tok.len++] = a;
+                q += n;
+            }
+            text[tok.len] = '\0';
+            tok.type = PGN_TOKEN_OTHER;
+            if( 0==strcmp(text,"1-0") || 0==strcmp(text,"0-1") || 0==strcmp(text,"1/2-1/2") )
+                tok.type = PGN_TOKEN_RESULT;
+            else if( 0==strncmp(text,"0-0",3) )
+            {
+                text[0] = 'O';          // 0-0 -> O-O, 0-0-0 -> O-O-O
+                text[2] = 'O';
+                if( 0==strncmp(text+3,"-0",2) )
+                    text[4] = 'O';
+                tok.type = PGN_TOKEN_SAN;
+            }
+        }
+        else
+        {
+            int dots = 0;
+            while( q<end && *q=='.' )
+            {
+                dots++;
+                q++;
+            }
+            tok.type  = PGN_TOKEN_MOVE_NUMBER;
+            tok.black = (dots >= 3);
+        }
+        p = q;
+    }
+    else
+    {
+        n = PEEK(p,a);
+
+        // Move
+        if( (Class(a)&CC_ALPHA) )
+        {
+            q = p;
+            while( q < end )
+            {
+                n = PEEK(q,a);
+                if( !(Class(a)&CC_SAN) )
+                    break;
+                bool pawn_figurine = (tok.len==0 && a=='P' && n>1);
+                if( !pawn_figurine && tok.len<PGN_TOKEN_MAXLEN )
+                    text[tok.len++] = a;
+                q += n;
+            }
+            tok.type = PGN_TOKEN_SAN;
+            p = q;
+        }
+
+        // Punctuation
+        else if( (Class(a)&CC_GLYPH) )
+        {
+            q = p;
+            while( q < end )
+            {
+                n = PEEK(q,a);
+                if( !(Class(a)&CC_GLYPH) )
+                    break;
+                if( tok.len < PGN_TOKEN_MAXLEN )
+                    text[tok.len++] = a;
+                q += n;
+            }
+            tok.type = PGN_TOKEN_GLYPH;
+            p = q;
+        }
+
+        // Anything else, one (possibly multi-byte) character at a time
+        else
+        {
+            tok.type = PGN_TOKEN_OTHER;
+            tok.txt  = p;
+            tok.len  = n;
+            p += n;
+        }
+    }
+    if( tok.txt == text )
+        text[tok.len] = '\0';
+    tok.end = Offset();
+    return true;
+}
+
+PgnMappedFile::PgnMappedFile()
+{
+    data = NULL;
+    len = 0;
+    mapped = false;
+}
+
+PgnMappedFile::~PgnMappedFile()
+{
+    Close();
+}
+
+bool PgnMappedFile::Open( FILE *f )
+{
+    Close();
+#ifdef THC_UNIX
+    struct stat st;
+    int fd = fileno(f);
+    if( fstat(fd,&st)==0 && st.st_size>0 )
+    {
+        void *m = mmap( NULL, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0 );
+        if( m != MAP_FAILED )
+        {
+            data = static_cast<const char *>(m);
+            len = static_cast<size_t>(st.st_size);
+            mapped = true;
+            return true;
+        }
+    }
+#endif
+
+    // Otherwise read the whole thing in
+    int64_t posn = ftell64(f);
+    fseek64( f, 0, SEEK_END );
+    int64_t file_len = ftell64(f);
+    fseek64( f, 0, SEEK_SET );
+    if( file_len > 0 )
+    {
+        contents.resize( static_cast<size_t>(file_len) );
+        contents.resize( fread( &contents[0], 1, contents.size(), f ) );
+    }
+    fseek64( f, posn, SEEK_SET );
+    data = contents.c_str();
+    len = contents.length();
+    return file_len >= 0;
+}
+
+void PgnMappedFile::Close()
+{
+#ifdef THC_UNIX
+    if( mapped )
+        munmap( const_cast<char *>(data), len );
+#endif
+    mapped = false;
+    contents.clear();
+    data = NULL;
+    len = 0;
+}
@@ -0,0 +1,86 @@
+/****************************************************************************
+ * Split PGN text into tokens (tags, move numbers, SAN moves, comments,
+ *  NAGs, variations and results) with a single table driven scanner
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef PGN_TOKENIZER_H
+#define PGN_TOKENIZER_H
+#include <stdio.h>
+#include <stddef.h>
+#include <string>
+
+#define PGN_TOKEN_MAXLEN 200    // longer moves, glyphs etc. are truncated (but still skipped over)
+
+enum PgnTokenType
+{
+    PGN_TOKEN_END,              // no more input
+    PGN_TOKEN_TAG,              // [Name "Value"], brackets included
+    PGN_TOKEN_MOVE_NUMBER,      // 12. or 12... (value = 12, black = true for the latter)
+    PGN_TOKEN_SAN,              // a move, eg Nf3, exd8=Q+, O-O. Figurines, 0-0 etc. are normalised
+    PGN_TOKEN_RESULT,           // 1-0, 0-1, 1/2-1/2 or *
+    PGN_TOKEN_COMMENT,          // {comment} or ;comment, text excludes the delimiters
+    PGN_TOKEN_NAG,              // $n (value = n)
+    PGN_TOKEN_GLYPH,            // a run of punctuation like !?, +/- or -- (null move)
+    PGN_TOKEN_VARIATION_START,  // (
+    PGN_TOKEN_VARIATION_END,    // )
+    PGN_TOKEN_OTHER             // anything else, eg a stray character
+};
+
+struct PgnToken
+{
+    PgnTokenType type;
+    const char  *txt;           // nul terminated, except TAG and COMMENT which point into the buffer
+    int          len;
+    int          value;         // MOVE_NUMBER and NAG
+    bool         black;         // MOVE_NUMBER was followed by "..."
+    char         comment_ch;    // COMMENT, '{' or ';'
+    size_t       offset;        // position of the token in the buffer
+    size_t       end;           // position just after the token
+};
+
+class PgnTokenizer
+{
+public:
+
+    // Buffer must outlive the tokenizer. A UTF-8 BOM at the start is skipped. ';'
+    //  comments are only recognised if use_semi, [tags] only if tags
+    PgnTokenizer( const char *buf, size_t len, bool use_semi=true, bool tags=false );
+
+    // Returns false (and type PGN_TOKEN_END) once the buffer is exhausted
+    bool Next( PgnToken &tok );
+
+    size_t Offset() const { return static_cast<size_t>(p-buf); }
+    size_t Length() const { return len; }
+
+private:
+    const char *buf;
+    const char *p;
+    const char *end;
+    size_t      len;
+    bool        use_semi;
+    bool        tags;
+    char        text[PGN_TOKEN_MAXLEN+1];
+    int         Utf8( const unsigned char *s, char &ascii );
+};
+
+// A whole file in memory, mapped where the OS allows it, otherwise read in
+class PgnMappedFile
+{
+public:
+    PgnMappedFile();
+    ~PgnMappedFile();
+    bool Open( FILE *f );       // from the start of the file, f itself isn't disturbed
+    void Close();
+    const char *Data() const { return data; }
+    size_t Length() const { return len; }
+
+private:
+    const char  *data;
+    size_t      len;
+    bool        mapped;
+    std::string contents;
+};
+
+#endif // PGN_TOKENIZER_H
@@ -0,0 +1,157 @@
+/****************************************************************************
+ * Repertoire coverage, how often database games reach each position of a
+ *  repertoire (a game with variations) and the popular moves it's missing
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <stdio.h>
+#include <algorithm>
+#include <unordered_map>
+#include "CompressMoves.h"
+#include "Repertoire.h"
+
+// Games and score, for comments
+static std::string StatsText( int nbr_games, int white_wins, int black_wins )
+{
+    char buf[100];
+    int draws_plus_no_result = nbr_games - white_wins - black_wins;
+    double percent_score = 0.0;
+    if( nbr_games )
+        percent_score = ((1.0*white_wins + 0.5*draws_plus_no_result) * 100.0) / nbr_games;
+    sprintf( buf, "%d %s, white scores %.1f%%", nbr_games, nbr_games==1 ? "game" : "games", percent_score );
+    return std::string(buf);
+}
+
+int RepertoireCoverage::Calculate( MoveTree &tree, MemoryPositionSearch &mps, std::vector< smart_ptr<ListableGame> > *source,
+                                   ProgressBar *progress, int min_games, int min_percent )
+{
+    positions.clear();
+    before.clear();
+    after.clear();
+    nbr_deviations = 0;
+    start = 0;
+    tree.Nodes( nodes );
+    if( !tree.root )
+        return 0;
+
+    // Transpositions within the repertoire are one position, so their moves are
+    //  all known when deciding what's missing
+    std::unordered_map<uint64_t,int> index;
+    auto position_idx = [&]( const thc::ChessPosition &cp ) -> int
+    {
+        thc::ChessPosition temp = cp;     // Hash64Calculate() isn't const
+        uint64_t key = Hash64Key( temp.Hash64Calculate(), temp.white );
+        auto it = index.find(key);
+        if( it != index.end() )
+            return it->second;
+        RepertoirePosition rp;
+        rp.cp = cp;
+        rp.nbr_games = rp.white_wins = rp.black_wins = rp.draws = 0;
+        int idx = static_cast<int>(positions.size());
+        positions.push_back( rp );
+        index[key] = idx;
+        return idx;
+    };
+    start = position_idx( *tree.root );
+    for( const MOVE_TREE_NODE &n: nodes )
+    {
+        int idx = position_idx( n.cp );
+        before.push_back( idx );
+        thc::Move mv = n.node->game_move.move;
+        std::vector<thc::Move> &moves = positions[idx].repertoire_moves;
+        if( std::find(moves.begin(),moves.end(),mv) == moves.end() )
+            moves.push_back( mv );
+        thc::ChessRules cr = n.cp;
+        cr.PlayMove( mv );
+        after.push_back( position_idx(cr) );
+    }
+
+    // One pass over the games for every position
+    std::vector<thc::ChessPosition> targets;
+    for( const RepertoirePosition &rp: positions )
+        targets.push_back( rp.cp );
+    std::vector<MpsBatchResult> results;
+    mps.DoBatchSearch( targets, progress, results, source, true );
+    for( size_t i=0; i<positions.size(); i++ )
+    {
+        RepertoirePosition &rp = positions[i];
+        const PositionStats &stats = results[i].stats;
+        rp.nbr_games  = results[i].games_found.size();
+        rp.white_wins = stats.total_white_wins;
+        rp.black_wins = stats.total_black_wins;
+        rp.draws      = stats.total_draws;
+
+        // Where the repertoire stops, database moves aren't deviations
+        if( rp.repertoire_moves.size() == 0 )
+            continue;
+        for( std::map<char,MOVE_STATS>::const_iterator it=stats.stats.begin(); it!=stats.stats.end(); it++ )
+        {
+            const MOVE_STATS &ms = it->second;
+            if( ms.nbr_games<min_games || ms.nbr_games*100<min_percent*rp.nbr_games )
+                continue;
+            CompressMoves press( rp.cp );
+            RepertoireMove dev;
+            dev.move = press.UncompressMove( it->first );
+            dev.ms = ms;
+            if( std::find(rp.repertoire_moves.begin(),rp.repertoire_moves.end(),dev.move) == rp.repertoire_moves.end() )
+                rp.deviations.push_back( dev );
+        }
+        std::sort( rp.deviations.begin(), rp.deviations.end(),
+            []( const RepertoireMove &a, const RepertoireMove &b ) { return a.ms.nbr_games > b.ms.nbr_games; } );
+        nbr_deviations += rp.deviations.size();
+    }
+    return positions.size();
+}
+
+// Note that the deviation variations added aren't in nodes
+void RepertoireCoverage::Annotate( MoveTree &tree )
+{
+    char buf[200];
+    const RepertoirePosition &rp_start = After(-1);
+    sprintf( buf, "Database coverage of %d repertoire positions, %d popular moves missing (added as variations)",
+             static_cast<int>(positions.size()), nbr_deviations );
+    std::string summary = buf;
+    summary += ". Start position " + StatsText( rp_start.nbr_games, rp_start.white_wins, rp_start.black_wins );
+    if( tree.game_move.comment.length() )
+        tree.game_move.comment += " ";
+    tree.game_move.comment += summary;
+
+    // Comments, until a line has left the database
+    std::vector<bool> first_from_position( positions.size(), false );
+    std::vector<int> deviation_nodes;
+    for( size_t i=0; i<nodes.size(); i++ )
+    {
+        const RepertoirePosition &rp   = After(i);
+        const RepertoirePosition &prev = Before(i);
+        if( !first_from_position[before[i]] )
+        {
+            first_from_position[before[i]] = true;
+            if( prev.deviations.size() )
+                deviation_nodes.push_back( i );
+        }
+        if( prev.nbr_games == 0 )
+            continue;
+        std::string txt = rp.nbr_games ? StatsText(rp.nbr_games,rp.white_wins,rp.black_wins) : "Leaves the database";
+        GAME_MOVE &gm = nodes[i].node->game_move;
+        if( gm.comment.length() )
+            gm.comment += " ";
+        gm.comment += txt;
+    }
+
+    // Deviations, from the last node back so that adding a variation to a node
+    //  only moves nodes that are already done
+    for( int j=static_cast<int>(deviation_nodes.size())-1; j>=0; j-- )
+    {
+        int i = deviation_nodes[j];
+        for( const RepertoireMove &dev: Before(i).deviations )
+        {
+            MoveTree child;
+            child.game_move.move = dev.move;
+            child.game_move.comment = "Not in repertoire, " + StatsText( dev.ms.nbr_games, dev.ms.nbr_white_wins, dev.ms.nbr_black_wins );
+            VARIATION variation;
+            variation.push_back( child );
+            nodes[i].node->variations.push_back( variation );
+        }
+    }
+}
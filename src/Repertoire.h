@@ -0,0 +1,70 @@
+/****************************************************************************
+ * Repertoire coverage, how often database games reach each position of a
+ *  repertoire (a game with variations) and the popular moves it's missing
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef REPERTOIRE_H
+#define REPERTOIRE_H
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "thc.h"
+#include "MoveTree.h"
+#include "ListableGame.h"
+#include "ProgressBar.h"
+#include "MemoryPositionSearch.h"
+
+// Popular database moves missing from the repertoire, at least this many games
+//  and this percentage of the games reaching the position
+#define REPERTOIRE_MIN_GAMES    10
+#define REPERTOIRE_MIN_PERCENT  5
+
+// A database move played in a repertoire position
+struct RepertoireMove
+{
+    thc::Move move;
+    MOVE_STATS ms;
+};
+
+// A repertoire position, the start position or the position after a move
+struct RepertoirePosition
+{
+    thc::ChessPosition cp;
+    int nbr_games;
+    int white_wins;
+    int black_wins;
+    int draws;
+    std::vector<thc::Move> repertoire_moves;    // played from here, in any line reaching here
+    std::vector<RepertoireMove> deviations;     // most played first
+};
+
+class RepertoireCoverage
+{
+public:
+
+    // Find every position of the repertoire in the games of source with one
+    //  MemoryPositionSearch::DoBatchSearch(), returns the number of positions
+    int Calculate( MoveTree &tree, MemoryPositionSearch &mps, std::vector< smart_ptr<ListableGame> > *source,
+                   ProgressBar *progress, int min_games=REPERTOIRE_MIN_GAMES, int min_percent=REPERTOIRE_MIN_PERCENT );
+
+    // Comment each move of the repertoire with its game count and score, and add
+    //  the deviations as variations (each at the first move from its position)
+    void Annotate( MoveTree &tree );
+
+    // The position before and after each move, -1 if there's no move (for start)
+    const RepertoirePosition &Before( int node_idx ) const { return positions[ before[node_idx] ]; }
+    const RepertoirePosition &After( int node_idx )  const { return positions[ node_idx<0 ? start : after[node_idx] ]; }
+
+    std::vector<MOVE_TREE_NODE> nodes;          // every move, see MoveTree::Nodes()
+    std::vector<RepertoirePosition> positions;  // distinct positions (transpositions are the same position)
+    int nbr_deviations;
+
+private:
+    int start;                  // idx into positions
+    std::vector<int> before;    // for each node, idx into positions
+    std::vector<int> after;
+};
+
+#endif // REPERTOIRE_H
@@ -163,6 +163,15 @@ Repository::Repository( bool use_defaults )
         ReadBool    ("DatabaseEloCutoffFail",       database.m_elo_cutoff_fail );
         ReadBool    ("DatabaseEloCutoffPass",       database.m_elo_cutoff_pass );
         ReadBool    ("DatabaseEloCutoffPassBefore", database.m_elo_cutoff_pass_before );
+        config->Read("DatabaseOpeningTreeDepth",    &database.m_opening_tree_depth );
+        config->Read("DatabaseOpeningTreeMinGames", &database.m_opening_tree_min_games );
+        config->Read("DatabaseSearchMinElo",        &database.m_search_min_elo );
+        config->Read("DatabaseSearchFromYear",      &database.m_search_from_year );
+        config->Read("DatabaseSearchToYear",        &database.m_search_to_year );
+        ReadBool    ("DatabaseSearchWhiteWins",     database.m_search_white_wins );
+        ReadBool    ("DatabaseSearchBlackWins",     database.m_search_black_wins );
+        ReadBool    ("DatabaseSearchDraws",         database.m_search_draws );
+        ReadBool    ("DatabaseSearchNoResult",      database.m_search_no_result );
 
         // General
         config->Read("GeneralNotationLanguage",          &general.m_notation_language );
@@ -393,6 +402,15 @@ Repository::~Repository()
     config->Write("DatabaseEloCutoffFail",       (int)database.m_elo_cutoff_fail );
     config->Write("DatabaseEloCutoffPass",       (int)database.m_elo_cutoff_pass );
     config->Write("DatabaseEloCutoffPassBefore", (int)database.m_elo_cutoff_pass_before );
+    config->Write("DatabaseOpeningTreeDepth",    database.m_opening_tree_depth );
+    config->Write("DatabaseOpeningTreeMinGames", database.m_opening_tree_min_games );
+    config->Write("DatabaseSearchMinElo",        database.m_search_min_elo );
+    config->Write("DatabaseSearchFromYear",      database.m_search_from_year );
+    config->Write("DatabaseSearchToYear",        database.m_search_to_year );
+    config->Write("DatabaseSearchWhiteWins",     (int)database.m_search_white_wins );
+    config->Write("DatabaseSearchBlackWins",     (int)database.m_search_black_wins );
+    config->Write("DatabaseSearchDraws",         (int)database.m_search_draws );
+    config->Write("DatabaseSearchNoResult",      (int)database.m_search_no_result );
 
     // Engine
     config->Write("EngineExeFile",      engine.m_file   );
@@ -206,6 +206,15 @@ struct DatabaseConfig
     bool        m_elo_cutoff_pass;
     bool        m_elo_cutoff_pass_before;
     int         m_elo_cutoff_before_year;
+    int         m_opening_tree_depth;       // plies, 0 for no opening tree
+    int         m_opening_tree_min_games;
+    int         m_search_min_elo;           // position and pattern searches, 0 for any
+    int         m_search_from_year;
+    int         m_search_to_year;
+    bool        m_search_white_wins;        // results searches find, all true for any
+    bool        m_search_black_wins;
+    bool        m_search_draws;
+    bool        m_search_no_result;
     DatabaseConfig()
     {
         m_file = DEFAULT_DATABASE;
@@ -217,6 +226,15 @@ struct DatabaseConfig
         m_elo_cutoff_pass = true;
         m_elo_cutoff_pass_before = false;
         m_elo_cutoff_before_year = 1990;
+        m_opening_tree_depth = 20;
+        m_opening_tree_min_games = 10;
+        m_search_min_elo = 0;
+        m_search_from_year = 0;
+        m_search_to_year = 0;
+        m_search_white_wins = true;
+        m_search_black_wins = true;
+        m_search_draws = true;
+        m_search_no_result = true;
     }
 };
 
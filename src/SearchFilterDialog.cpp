@@ -0,0 +1,259 @@
+/****************************************************************************
+ * Custom dialog - Search filter, the games position and pattern searches
+ *  consider (by Elo, year and result)
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include "wx/wx.h"
+#include "wx/valtext.h"
+#include "wx/valgen.h"
+#include "Appdefs.h"
+#include "SearchFilterDialog.h"
+
+// SearchFilterDialog type definition
+IMPLEMENT_CLASS( SearchFilterDialog, wxDialog )
+
+// SearchFilterDialog event table definition
+BEGIN_EVENT_TABLE( SearchFilterDialog, wxDialog )
+    EVT_BUTTON( ID_SEARCH_FILTER_RESET, SearchFilterDialog::OnResetClick )
+    EVT_BUTTON( wxID_OK, SearchFilterDialog::OnOkClick )
+    EVT_BUTTON( wxID_HELP, SearchFilterDialog::OnHelpClick )
+END_EVENT_TABLE()
+
+// SearchFilterDialog constructors
+SearchFilterDialog::SearchFilterDialog()
+{
+    Init();
+}
+
+SearchFilterDialog::SearchFilterDialog( wxWindow* parent,
+  wxWindowID id, const wxString& caption,
+  const wxPoint& pos, const wxSize& size, long style )
+{
+    Init();
+    Create(parent, id, caption, pos, size, style);
+}
+
+// Initialisation, no filter
+void SearchFilterDialog::Init()
+{
+    dat.m_search_min_elo    = 0;
+    dat.m_search_from_year  = 0;
+    dat.m_search_to_year    = 0;
+    dat.m_search_white_wins = true;
+    dat.m_search_black_wins = true;
+    dat.m_search_draws      = true;
+    dat.m_search_no_result  = true;
+}
+
+// Dialog create
+bool SearchFilterDialog::Create( wxWindow* parent,
+  wxWindowID id, const wxString& caption,
+  const wxPoint& pos, const wxSize& size, long style )
+{
+    bool okay=true;
+
+    // We have to set extra styles before creating the dialog
+    SetExtraStyle( wxWS_EX_BLOCK_EVENTS/*|wxDIALOG_EX_CONTEXTHELP*/ );
+    if( !wxDialog::Create( parent, id, caption, pos, size, style ) )
+        okay = false;
+    else
+    {
+        CreateControls();
+        SetDialogHelp();
+        SetDialogValidators();
+
+        // This fits the dialog to the minimum size dictated by the sizers
+        GetSizer()->Fit(this);
+
+        // This ensures that the dialog cannot be sized smaller than the minimum size
+        GetSizer()->SetSizeHints(this);
+
+        // Centre the dialog on the parent or (if none) screen
+        Centre();
+    }
+    return okay;
+}
+
+// Control creation for SearchFilterDialog
+void SearchFilterDialog::CreateControls()
+{
+
+    // A top-level sizer
+    wxBoxSizer* top_sizer = new wxBoxSizer(wxVERTICAL);
+    this->SetSizer(top_sizer);
+
+    // A second box sizer to give more space around the controls
+    wxBoxSizer* box_sizer = new wxBoxSizer(wxVERTICAL);
+    top_sizer->Add(box_sizer, 0, wxALIGN_CENTER_HORIZONTAL|wxALL, 5);
+
+    // A friendly message
+    wxStaticText* descr = new wxStaticText( this, wxID_STATIC,
+        wxT("Position and pattern searches only find games that pass this filter."), wxDefaultPosition, wxDefaultSize, 0 );
+    box_sizer->Add(descr, 0, wxALIGN_LEFT|wxALL, 5);
+
+    // Spacer
+    box_sizer->Add(5, 5, 0, wxALIGN_CENTER_HORIZONTAL|wxALL, 5);
+
+    // Label and spin control for the minimum Elo
+    wxBoxSizer* elo_sizer = new wxBoxSizer(wxHORIZONTAL);
+    box_sizer->Add(elo_sizer, 0, wxALL, 0);
+    wxStaticText* min_elo_label = new wxStaticText ( this, wxID_STATIC,
+        wxT("&Both players rated at least (0 for any):"), wxDefaultPosition, wxDefaultSize, 0 );
+    elo_sizer->Add(min_elo_label, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+    wxSpinCtrl* min_elo_spin = new wxSpinCtrl ( this, ID_SEARCH_FILTER_MIN_ELO,
+        wxEmptyString, wxDefaultPosition, wxSize(80, -1),
+        wxSP_ARROW_KEYS, 0, 4000, 0 );
+    elo_sizer->Add(min_elo_spin, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+
+    // Labels and spin controls for the years
+    wxBoxSizer* year_sizer = new wxBoxSizer(wxHORIZONTAL);
+    box_sizer->Add(year_sizer, 0, wxALL, 0);
+    wxStaticText* from_year_label = new wxStaticText ( this, wxID_STATIC,
+        wxT("&From year (0 for any):"), wxDefaultPosition, wxDefaultSize, 0 );
+    year_sizer->Add(from_year_label, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+    wxSpinCtrl* from_year_spin = new wxSpinCtrl ( this, ID_SEARCH_FILTER_FROM_YEAR,
+        wxEmptyString, wxDefaultPosition, wxSize(80, -1),
+        wxSP_ARROW_KEYS, 0, 3000, 0 );
+    year_sizer->Add(from_year_spin, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+    wxStaticText* to_year_label = new wxStaticText ( this, wxID_STATIC,
+        wxT("&To year:"), wxDefaultPosition, wxDefaultSize, 0 );
+    year_sizer->Add(to_year_label, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+    wxSpinCtrl* to_year_spin = new wxSpinCtrl ( this, ID_SEARCH_FILTER_TO_YEAR,
+        wxEmptyString, wxDefaultPosition, wxSize(80, -1),
+        wxSP_ARROW_KEYS, 0, 3000, 0 );
+    year_sizer->Add(to_year_spin, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+
+    // Results
+    wxBoxSizer* result_sizer = new wxBoxSizer(wxHORIZONTAL);
+    box_sizer->Add(result_sizer, 0, wxALL, 0);
+    wxCheckBox* white_wins_box = new wxCheckBox( this, ID_SEARCH_FILTER_WHITE_WINS,
+       wxT("&White wins"), wxDefaultPosition, wxDefaultSize, 0 );
+    result_sizer->Add( white_wins_box, 0, wxALL, 5);
+    wxCheckBox* black_wins_box = new wxCheckBox( this, ID_SEARCH_FILTER_BLACK_WINS,
+       wxT("B&lack wins"), wxDefaultPosition, wxDefaultSize, 0 );
+    result_sizer->Add( black_wins_box, 0, wxALL, 5);
+    wxCheckBox* draws_box = new wxCheckBox( this, ID_SEARCH_FILTER_DRAWS,
+       wxT("&Draws"), wxDefaultPosition, wxDefaultSize, 0 );
+    result_sizer->Add( draws_box, 0, wxALL, 5);
+    wxCheckBox* no_result_box = new wxCheckBox( this, ID_SEARCH_FILTER_NO_RESULT,
+       wxT("&No result"), wxDefaultPosition, wxDefaultSize, 0 );
+    result_sizer->Add( no_result_box, 0, wxALL, 5);
+
+    // A dividing line before the OK and Cancel buttons
+    wxStaticLine* line = new wxStaticLine ( this, wxID_STATIC,
+        wxDefaultPosition, wxDefaultSize, wxLI_HORIZONTAL );
+    box_sizer->Add(line, 0, wxGROW|wxALL, 5);
+
+    // A horizontal box sizer to contain Reset, OK, Cancel and Help
+    wxBoxSizer* okCancelBox = new wxBoxSizer(wxHORIZONTAL);
+    box_sizer->Add(okCancelBox, 0, wxALIGN_CENTER_HORIZONTAL|wxALL, 15);
+
+    // The Reset button
+    wxButton* reset = new wxButton( this, ID_SEARCH_FILTER_RESET, wxT("&Reset"),
+        wxDefaultPosition, wxDefaultSize, 0 );
+    okCancelBox->Add(reset, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+
+    // The OK button
+    wxButton* ok = new wxButton ( this, wxID_OK, wxT("&OK"),
+        wxDefaultPosition, wxDefaultSize, 0 );
+    okCancelBox->Add(ok, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+
+    // The Cancel button
+    wxButton* cancel = new wxButton ( this, wxID_CANCEL,
+        wxT("&Cancel"), wxDefaultPosition, wxDefaultSize, 0 );
+    okCancelBox->Add(cancel, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+
+    // The Help button
+    wxButton* help = new wxButton( this, wxID_HELP, wxT("&Help"),
+        wxDefaultPosition, wxDefaultSize, 0 );
+    okCancelBox->Add(help, 0, wxALIGN_CENTER_VERTICAL|wxALL, 5);
+}
+
+// Set the validators for the dialog controls
+void SearchFilterDialog::SetDialogValidators()
+{
+    FindWindow(ID_SEARCH_FILTER_MIN_ELO)->SetValidator(
+        wxGenericValidator(& dat.m_search_min_elo));
+    FindWindow(ID_SEARCH_FILTER_FROM_YEAR)->SetValidator(
+        wxGenericValidator(& dat.m_search_from_year));
+    FindWindow(ID_SEARCH_FILTER_TO_YEAR)->SetValidator(
+        wxGenericValidator(& dat.m_search_to_year));
+    FindWindow(ID_SEARCH_FILTER_WHITE_WINS)->SetValidator(
+        wxGenericValidator(& dat.m_search_white_wins));
+    FindWindow(ID_SEARCH_FILTER_BLACK_WINS)->SetValidator(
+        wxGenericValidator(& dat.m_search_black_wins));
+    FindWindow(ID_SEARCH_FILTER_DRAWS)->SetValidator(
+        wxGenericValidator(& dat.m_search_draws));
+    FindWindow(ID_SEARCH_FILTER_NO_RESULT)->SetValidator(
+        wxGenericValidator(& dat.m_search_no_result));
+}
+
+// Sets the help text for the dialog controls
+void SearchFilterDialog::SetDialogHelp()
+{
+    wxString min_elo_help   = wxT("Only games where both players are rated at least this much. Zero for any games.");
+    wxString from_year_help = wxT("Only games played in this year or later. Zero for any year.");
+    wxString to_year_help   = wxT("Only games played in this year or earlier. Zero for any year.");
+    wxString result_help    = wxT("Only games with the results ticked.");
+
+    FindWindow(ID_SEARCH_FILTER_MIN_ELO)   ->SetHelpText(min_elo_help);
+    FindWindow(ID_SEARCH_FILTER_MIN_ELO)   ->SetToolTip(min_elo_help);
+
+    FindWindow(ID_SEARCH_FILTER_FROM_YEAR) ->SetHelpText(from_year_help);
+    FindWindow(ID_SEARCH_FILTER_FROM_YEAR) ->SetToolTip(from_year_help);
+
+    FindWindow(ID_SEARCH_FILTER_TO_YEAR)   ->SetHelpText(to_year_help);
+    FindWindow(ID_SEARCH_FILTER_TO_YEAR)   ->SetToolTip(to_year_help);
+
+    FindWindow(ID_SEARCH_FILTER_WHITE_WINS)->SetHelpText(result_help);
+    FindWindow(ID_SEARCH_FILTER_WHITE_WINS)->SetToolTip(result_help);
+    FindWindow(ID_SEARCH_FILTER_BLACK_WINS)->SetHelpText(result_help);
+    FindWindow(ID_SEARCH_FILTER_BLACK_WINS)->SetToolTip(result_help);
+    FindWindow(ID_SEARCH_FILTER_DRAWS)     ->SetHelpText(result_help);
+    FindWindow(ID_SEARCH_FILTER_DRAWS)     ->SetToolTip(result_help);
+    FindWindow(ID_SEARCH_FILTER_NO_RESULT) ->SetHelpText(result_help);
+    FindWindow(ID_SEARCH_FILTER_NO_RESULT) ->SetToolTip(result_help);
+}
+
+// wxEVT_COMMAND_BUTTON_CLICKED event handler for ID_SEARCH_FILTER_RESET
+void SearchFilterDialog::OnResetClick( wxCommandEvent& WXUNUSED(event) )
+{
+    Init();
+    TransferDataToWindow();
+}
+
+// wxEVT_COMMAND_BUTTON_CLICKED event handler for wxID_OK
+void SearchFilterDialog::OnOkClick( wxCommandEvent& WXUNUSED(event) )
+{
+    if( TransferDataFromWindow() )
+    {
+        if( !dat.m_search_white_wins && !dat.m_search_black_wins && !dat.m_search_draws && !dat.m_search_no_result )
+        {
+            wxMessageBox( "Tick at least one result", "Search filter", wxOK|wxICON_ERROR, this );
+            return;
+        }
+        if( dat.m_search_from_year>0 && dat.m_search_to_year>0 && dat.m_search_from_year>dat.m_search_to_year )
+        {
+            wxMessageBox( "The from year is after the to year", "Search filter", wxOK|wxICON_ERROR, this );
+            return;
+        }
+        AcceptAndClose();
+    }
+}
+
+// wxEVT_COMMAND_BUTTON_CLICKED event handler for wxID_HELP
+void SearchFilterDialog::OnHelpClick( wxCommandEvent& WXUNUSED(event) )
+{
+    wxString helpText =
+      wxT("\nUse this panel to restrict position and pattern searches\n")
+      wxT("to games between rated players, from a range of years or\n")
+      wxT("with particular results. The filter is remembered and\n")
+      wxT("applies to all later searches until it is reset.\n\n")
+      wxT("The Next Move statistics count the filtered games only.\n");
+
+    wxMessageBox(helpText,
+      wxT("Search Filter Dialog Help"),
+      wxOK|wxICON_INFORMATION, this);
+}
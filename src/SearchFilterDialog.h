@@ -0,0 +1,87 @@
+/****************************************************************************
+ * Custom dialog - Search filter, the games position and pattern searches
+ *  consider (by Elo, year and result)
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef SEARCH_FILTER_DIALOG_H
+#define SEARCH_FILTER_DIALOG_H
+
+#include "wx/spinctrl.h"
+#include "wx/statline.h"
+#include "SuspendEngine.h"
+#include "DialogDetect.h"
+#include "Repository.h"
+
+// Control identifiers
+enum
+{
+    ID_SEARCH_FILTER_DIALOG     = 10000,
+    ID_SEARCH_FILTER_MIN_ELO    = 10001,
+    ID_SEARCH_FILTER_FROM_YEAR  = 10002,
+    ID_SEARCH_FILTER_TO_YEAR    = 10003,
+    ID_SEARCH_FILTER_WHITE_WINS = 10004,
+    ID_SEARCH_FILTER_BLACK_WINS = 10005,
+    ID_SEARCH_FILTER_DRAWS      = 10006,
+    ID_SEARCH_FILTER_NO_RESULT  = 10007,
+    ID_SEARCH_FILTER_RESET      = 10008
+};
+
+// SearchFilterDialog class declaration
+class SearchFilterDialog: public wxDialog
+{
+    DECLARE_CLASS( SearchFilterDialog )
+    DECLARE_EVENT_TABLE()
+
+public:
+
+    // Constructors
+    SearchFilterDialog( );
+    SearchFilterDialog( wxWindow* parent,
+      wxWindowID id = ID_SEARCH_FILTER_DIALOG,
+      const wxString& caption = wxT("Search filter"),
+      const wxPoint& pos = wxDefaultPosition,
+      const wxSize& size = wxDefaultSize,
+      long style = wxCAPTION|wxRESIZE_BORDER|wxSYSTEM_MENU|wxCLOSE_BOX );
+
+    // Member initialisation
+    void Init();
+
+    // Creation
+    bool Create( wxWindow* parent,
+      wxWindowID id = ID_SEARCH_FILTER_DIALOG,
+      const wxString& caption = wxT("Search filter"),
+      const wxPoint& pos = wxDefaultPosition,
+      const wxSize& size = wxDefaultSize,
+      long style = wxCAPTION|wxRESIZE_BORDER|wxSYSTEM_MENU|wxCLOSE_BOX );
+
+    // Creates the controls and sizers
+    void CreateControls();
+
+    // Sets the validators for the dialog controls
+    void SetDialogValidators();
+
+    // Sets the help text for the dialog controls
+    void SetDialogHelp();
+
+    // SearchFilterDialog event handler declarations
+
+    // wxEVT_COMMAND_BUTTON_CLICKED event handler for ID_SEARCH_FILTER_RESET
+    void OnResetClick( wxCommandEvent& event );
+
+    // wxEVT_COMMAND_BUTTON_CLICKED event handler for wxID_OK
+    void OnOkClick( wxCommandEvent& event );
+
+    // wxEVT_COMMAND_BUTTON_CLICKED event handler for wxID_HELP
+    void OnHelpClick( wxCommandEvent& event );
+
+    // SearchFilterDialog member variables
+
+    // Data members (only the m_search_ fields are used)
+    DatabaseConfig  dat;
+    SuspendEngine   suspendor;  // the mere presence of this var suspends the engine during the dialog
+    DialogDetect    detect;     // similarly the presence of this var allows tracking of open dialogs
+};
+
+#endif    // SEARCH_FILTER_DIALOG_H
@@ -0,0 +1,321 @@
+/****************************************************************************
+ * Slim position, a plain thc::ChessPositionRaw with a small fixed size undo
+ *  stack for search and replay loops that would otherwise copy thc::ChessRules
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <string.h>
+#include "SlimPosition.h"
+
+Hash64Deltas::Hash64Deltas()
+{
+    const char *pieces = " PNBRQKpnbrqk";
+    memset( piece_idx, 0, sizeof(piece_idx) );
+    for( int i=1; i<13; i++ )
+        piece_idx[ static_cast<unsigned char>(pieces[i]) ] = i;
+    thc::ChessPosition cp;
+    memset( cp.squares, ' ', 64 );
+    empty = cp.Hash64Calculate();
+    for( int sq=0; sq<64; sq++ )
+    {
+        delta[sq][0] = 0;
+        for( int i=1; i<13; i++ )
+        {
+            cp.squares[sq] = pieces[i];
+            delta[sq][i] = cp.Hash64Calculate() ^ empty;
+        }
+        cp.squares[sq] = ' ';
+    }
+    int K=6, R=4, k=12, r=10;
+    castling[0] = delta[thc::e1][K] ^ delta[thc::g1][K] ^ delta[thc::h1][R] ^ delta[thc::f1][R];
+    castling[1] = delta[thc::e1][K] ^ delta[thc::c1][K] ^ delta[thc::a1][R] ^ delta[thc::d1][R];
+    castling[2] = delta[thc::e8][k] ^ delta[thc::g8][k] ^ delta[thc::h8][r] ^ delta[thc::f8][r];
+    castling[3] = delta[thc::e8][k] ^ delta[thc::c8][k] ^ delta[thc::a8][r] ^ delta[thc::d8][r];
+}
+
+// Built on first use, so it's safe to use from other modules' static initialisers
+const Hash64Deltas &Hash64DeltaTable()
+{
+    static Hash64Deltas table;
+    return table;
+}
+
+void SlimPosition::Init()
+{
+    white = true;
+    memcpy( squares,
+       "rnbqkbnr"
+       "pppppppp"
+       "        "
+       "        "
+       "        "
+       "        "
+       "PPPPPPPP"
+       "RNBQKBNR", 65 );
+    enpassant_target = thc::SQUARE_INVALID;
+    wking  = true;
+    wqueen = true;
+    bking  = true;
+    bqueen = true;
+    wking_square = thc::e1;
+    bking_square = thc::e8;
+    half_move_clock = 0;
+    full_move_count = 1;
+    undo_idx = 0;
+}
+
+// As thc::ChessPosition groomed_enpassant_target(), only a target if an enemy pawn
+//  could actually capture en passant
+static int GroomedEnpassantTarget( const thc::ChessPositionRaw &cp )
+{
+    int ep = cp.enpassant_target;
+    const char *squares = cp.squares;
+    if( cp.white && thc::a6<=ep && ep<=thc::h6 )
+    {
+        if( (ep>thc::a6 && squares[ep+7]=='P') || (ep<thc::h6 && squares[ep+9]=='P') )
+            return ep;
+    }
+    else if( !cp.white && thc::a3<=ep && ep<=thc::h3 )
+    {
+        if( (ep>thc::a3 && squares[ep-9]=='p') || (ep<thc::h3 && squares[ep-7]=='p') )
+            return ep;
+    }
+    return thc::SQUARE_INVALID;
+}
+
+// As thc::ChessPosition wking_allowed() etc, packed into bits
+static int CastlingAllowed( const thc::ChessPositionRaw &cp )
+{
+    const char *squares = cp.squares;
+    int allowed = 0;
+    if( squares[thc::e1]=='K' )
+    {
+        if( cp.wking && squares[thc::h1]=='R' )
+            allowed |= 1;
+        if( cp.wqueen && squares[thc::a1]=='R' )
+            allowed |= 2;
+    }
+    if( squares[thc::e8]=='k' )
+    {
+        if( cp.bking && squares[thc::h8]=='r' )
+            allowed |= 4;
+        if( cp.bqueen && squares[thc::a8]=='r' )
+            allowed |= 8;
+    }
+    return allowed;
+}
+
+bool SlimPosition::operator ==( const thc::ChessPositionRaw &other ) const
+{
+    return( white == other.white                                            &&
+            0 == memcmp( squares, other.squares, 64 )                       &&
+            GroomedEnpassantTarget(*this) == GroomedEnpassantTarget(other)  &&
+            CastlingAllowed(*this) == CastlingAllowed(other)
+          );
+}
+
+void SlimPosition::PlayMove( thc::Move mv )
+{
+    if( !white )
+        full_move_count++;
+    char piece = squares[mv.src];
+    if( piece=='P' || piece=='p' || mv.capture!=' ' )
+        half_move_clock = 0;
+    else
+        half_move_clock++;
+    PushMove( mv );
+}
+
+void SlimPosition::PushMove( thc::Move mv )
+{
+    undo[ undo_idx++ % SLIM_UNDO_DEPTH ] = *Detail();
+
+    // As in thc, a move to a king or rook home square rules out castling with them
+    //  from now on, moves from those squares don't matter because castling also
+    //  requires the king and rook to be present
+    switch( mv.dst )
+    {
+        case thc::e1: wking = wqueen = false;   break;
+        case thc::h1: wking = false;            break;
+        case thc::a1: wqueen = false;           break;
+        case thc::e8: bking = bqueen = false;   break;
+        case thc::h8: bking = false;            break;
+        case thc::a8: bqueen = false;           break;
+        default:                                break;
+    }
+    enpassant_target = thc::SQUARE_INVALID;
+    int src = mv.src;
+    int dst = mv.dst;
+    switch( mv.special )
+    {
+        default:
+            squares[dst] = squares[src];
+            squares[src] = ' ';
+            break;
+        case thc::SPECIAL_KING_MOVE:
+            squares[dst] = squares[src];
+            squares[src] = ' ';
+            if( white )
+                wking_square = mv.dst;
+            else
+                bking_square = mv.dst;
+            break;
+        case thc::SPECIAL_PROMOTION_QUEEN:
+            squares[src] = ' ';
+            squares[dst] = (white?'Q':'q');
+            break;
+        case thc::SPECIAL_PROMOTION_ROOK:
+            squares[src] = ' ';
+            squares[dst] = (white?'R':'r');
+            break;
+        case thc::SPECIAL_PROMOTION_BISHOP:
+            squares[src] = ' ';
+            squares[dst] = (white?'B':'b');
+            break;
+        case thc::SPECIAL_PROMOTION_KNIGHT:
+            squares[src] = ' ';
+            squares[dst] = (white?'N':'n');
+            break;
+        case thc::SPECIAL_WEN_PASSANT:
+            squares[src] = ' ';
+            squares[dst] = 'P';
+            squares[dst+8] = ' ';
+            break;
+        case thc::SPECIAL_BEN_PASSANT:
+            squares[src] = ' ';
+            squares[dst] = 'p';
+            squares[dst-8] = ' ';
+            break;
+        case thc::SPECIAL_WPAWN_2SQUARES:
+            squares[src] = ' ';
+            squares[dst] = 'P';
+            enpassant_target = static_cast<thc::Square>(dst+8);
+            break;
+        case thc::SPECIAL_BPAWN_2SQUARES:
+            squares[src] = ' ';
+            squares[dst] = 'p';
+            enpassant_target = static_cast<thc::Square>(dst-8);
+            break;
+        case thc::SPECIAL_WK_CASTLING:
+            squares[thc::e1] = ' ';
+            squares[thc::f1] = 'R';
+            squares[thc::g1] = 'K';
+            squares[thc::h1] = ' ';
+            wking_square = thc::g1;
+            break;
+        case thc::SPECIAL_WQ_CASTLING:
+            squares[thc::e1] = ' ';
+            squares[thc::d1] = 'R';
+            squares[thc::c1] = 'K';
+            squares[thc::a1] = ' ';
+            wking_square = thc::c1;
+            break;
+        case thc::SPECIAL_BK_CASTLING:
+            squares[thc::e8] = ' ';
+            squares[thc::f8] = 'r';
+            squares[thc::g8] = 'k';
+            squares[thc::h8] = ' ';
+            bking_square = thc::g8;
+            break;
+        case thc::SPECIAL_BQ_CASTLING:
+            squares[thc::e8] = ' ';
+            squares[thc::d8] = 'r';
+            squares[thc::c8] = 'k';
+            squares[thc::a8] = ' ';
+            bking_square = thc::c8;
+            break;
+    }
+    white = !white;
+}
+
+void SlimPosition::PopMove( thc::Move mv )
+{
+    *Detail() = undo[ --undo_idx % SLIM_UNDO_DEPTH ];
+    white = !white;
+    int src = mv.src;
+    int dst = mv.dst;
+    switch( mv.special )
+    {
+        default:
+            squares[src] = squares[dst];
+            squares[dst] = mv.capture;
+            break;
+        case thc::SPECIAL_PROMOTION_QUEEN:
+        case thc::SPECIAL_PROMOTION_ROOK:
+        case thc::SPECIAL_PROMOTION_BISHOP:
+        case thc::SPECIAL_PROMOTION_KNIGHT:
+            squares[src] = (white?'P':'p');
+            squares[dst] = mv.capture;
+            break;
+        case thc::SPECIAL_WEN_PASSANT:
+            squares[src] = 'P';
+            squares[dst] = ' ';
+            squares[dst+8] = 'p';
+            break;
+        case thc::SPECIAL_BEN_PASSANT:
+            squares[src] = 'p';
+            squares[dst] = ' ';
+            squares[dst-8] = 'P';
+            break;
+        case thc::SPECIAL_WK_CASTLING:
+            squares[thc::e1] = 'K';
+            squares[thc::f1] = ' ';
+            squares[thc::g1] = ' ';
+            squares[thc::h1] = 'R';
+            break;
+        case thc::SPECIAL_WQ_CASTLING:
+            squares[thc::e1] = 'K';
+            squares[thc::d1] = ' ';
+            squares[thc::c1] = ' ';
+            squares[thc::a1] = 'R';
+            break;
+        case thc::SPECIAL_BK_CASTLING:
+            squares[thc::e8] = 'k';
+            squares[thc::f8] = ' ';
+            squares[thc::g8] = ' ';
+            squares[thc::h8] = 'r';
+            break;
+        case thc::SPECIAL_BQ_CASTLING:
+            squares[thc::e8] = 'k';
+            squares[thc::d8] = ' ';
+            squares[thc::c8] = ' ';
+            squares[thc::a8] = 'r';
+            break;
+    }
+}
+
+uint64_t SlimPosition::Hash64Calculate() const
+{
+    const Hash64Deltas &z = Hash64DeltaTable();
+    uint64_t hash = z.empty;
+    for( int sq=0; sq<64; sq++ )
+        hash ^= z.delta[sq][ z.piece_idx[static_cast<unsigned char>(squares[sq])] ];
+    return hash;
+}
+
+uint64_t SlimPosition::Hash64Update( uint64_t hash, thc::Move mv ) const
+{
+    const Hash64Deltas &z = Hash64DeltaTable();
+    int src = mv.src;
+    int dst = mv.dst;
+    int moved = z.piece_idx[static_cast<unsigned char>(squares[src])];
+    int arrives = moved;
+    switch( mv.special )
+    {
+        case thc::SPECIAL_WK_CASTLING:  return hash ^ z.castling[0];
+        case thc::SPECIAL_WQ_CASTLING:  return hash ^ z.castling[1];
+        case thc::SPECIAL_BK_CASTLING:  return hash ^ z.castling[2];
+        case thc::SPECIAL_BQ_CASTLING:  return hash ^ z.castling[3];
+        case thc::SPECIAL_WEN_PASSANT:  return hash ^ z.delta[src][1] ^ z.delta[dst][1] ^ z.delta[dst+8][7];
+        case thc::SPECIAL_BEN_PASSANT:  return hash ^ z.delta[src][7] ^ z.delta[dst][7] ^ z.delta[dst-8][1];
+        case thc::SPECIAL_PROMOTION_QUEEN:  arrives = z.piece_idx[static_cast<unsigned char>(white?'Q':'q')];   break;
+        case thc::SPECIAL_PROMOTION_ROOK:   arrives = z.piece_idx[static_cast<unsigned char>(white?'R':'r')];   break;
+        case thc::SPECIAL_PROMOTION_BISHOP: arrives = z.piece_idx[static_cast<unsigned char>(white?'B':'b')];   break;
+        case thc::SPECIAL_PROMOTION_KNIGHT: arrives = z.piece_idx[static_cast<unsigned char>(white?'N':'n')];   break;
+        default:                                                                                        break;
+    }
+    return hash ^ z.delta[src][moved]
+                ^ z.delta[dst][ z.piece_idx[static_cast<unsigned char>(squares[dst])] ]
+                ^ z.delta[dst][arrives];
+}
@@ -0,0 +1,72 @@
+/****************************************************************************
+ * Slim position, a plain thc::ChessPositionRaw with a small fixed size undo
+ *  stack for search and replay loops that would otherwise copy thc::ChessRules
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#ifndef SLIM_POSITION_H
+#define SLIM_POSITION_H
+#include <stdint.h>
+#include "thc.h"
+
+// thc::ChessRules carries 256 entry history and detail ring arrays (about 2K bytes)
+//  and thc::ChessPosition a vtable, so copying either to replay a game is wasteful
+//  when all we want is the board. SlimPosition has no virtual functions and no
+//  history, it's trivially copyable and PushMove()/PopMove() only touch its own
+//  fixed size undo ring (which like thc's quietly wraps if moves are pushed more
+//  than SLIM_UNDO_DEPTH deep)
+#define SLIM_UNDO_DEPTH 64
+
+// Zobrist hash changes. The thc hash of a position (Hash64Calculate()) is the xor of
+//  a value for each square's contents, so a piece arriving on or leaving a square
+//  changes the hash by the same amount, which we can find from thc itself
+struct Hash64Deltas
+{
+    unsigned char piece_idx[256];   // ' ' (and anything else not a piece) -> 0, 'P' -> 1 etc.
+    uint64_t delta[64][13];         // [square][piece_idx], 0 for an empty square
+    uint64_t castling[4];           // king and rook together, WK, WQ, BK and BQ
+    uint64_t empty;                 // hash of an empty board
+    Hash64Deltas();
+};
+const Hash64Deltas &Hash64DeltaTable();
+
+struct SlimPosition : public thc::ChessPositionRaw
+{
+    SlimPosition() { Init(); }
+    SlimPosition( const thc::ChessPositionRaw &cp ) { Set(cp); }
+
+    // The standard starting position
+    void Init();
+
+    // Convert from and to the thc representation (thc::ChessPosition and
+    //  thc::ChessRules are both ChessPositionRaws). The undo stack is emptied
+    void Set( const thc::ChessPositionRaw &cp ) { *static_cast<thc::ChessPositionRaw *>(this) = cp; undo_idx = 0; }
+    void Get( thc::ChessPositionRaw &cp ) const { cp = *this; }
+
+    // Same as thc::ChessPosition operator ==, i.e. same side to move, squares, and
+    //  effective en passant target and castling rights, ignoring the counts
+    bool operator ==( const thc::ChessPositionRaw &other ) const;
+    bool operator !=( const thc::ChessPositionRaw &other ) const { return !(*this == other); }
+
+    // Same effect as thc::ChessRules PlayMove() (including the counts), PushMove()
+    //  and PopMove(). As with thc moves must be legal and PopMove() needs the move
+    //  (with capture) that was pushed
+    void PlayMove( thc::Move mv );
+    void PushMove( thc::Move mv );
+    void PopMove( thc::Move mv );
+
+    // Same results as thc::ChessPosition Hash64Calculate() and Hash64Update(), for
+    //  positions with regular pieces
+    uint64_t Hash64Calculate() const;
+    uint64_t Hash64Update( uint64_t hash, thc::Move mv ) const;
+
+private:
+    // As in thc, the en passant target, king squares and castling flags are the last
+    //  32 bits of ChessPositionRaw and are saved and restored as a unit
+    uint32_t *Detail() { return reinterpret_cast<uint32_t *>( reinterpret_cast<char *>(static_cast<thc::ChessPositionRaw *>(this)) + sizeof(thc::ChessPositionRaw) - sizeof(uint32_t) ); }
+    uint32_t undo[SLIM_UNDO_DEPTH];
+    unsigned undo_idx;
+};
+
+#endif // SLIM_POSITION_H
@@ -18,6 +18,7 @@
 #include "DebugPrintf.h"
 #include "Repository.h"
 #include "Objects.h"
+#include "BitboardPosition.h"
 using namespace std;
 using namespace thc;
 
@@ -587,7 +588,7 @@ void UciInterface::Kibitz( thc::ChessPosition &pos, const char *forsyth )
         // Don't ask chess engines to analyse illegal positions or checkmates/stalemates
         thc::ChessRules cr = pos;
         thc::TERMINAL terminal;
-        bool ok = cr.Evaluate( terminal );
+        bool ok = BitboardEvaluate( &cr, terminal );
         if( ok )
         {
             bool game_over = (terminal==TERMINAL_WCHECKMATE || terminal==TERMINAL_WSTALEMATE || terminal==TERMINAL_BCHECKMATE || terminal==TERMINAL_BSTALEMATE );
@@ -1374,7 +1375,7 @@ void UciInterface::line_out( const char *s )
                 p += strlen(temp);
                 thc::Move move;
                 thc::ChessRules cr=pos_engine_to_move;
-                bool legal = move.TerseIn(&cr,p);
+                bool legal = BitboardTerseIn(move,&cr,p);
                 if( !legal )
                     release_printf( "**!! False bestmove %s detected !!**\n", p );
                 else
@@ -1390,7 +1391,7 @@ void UciInterface::line_out( const char *s )
                         cr.PlayMove(move);
                         p += strlen(temp);
                         thc::Move ponder;
-                        bool ok = ponder.TerseIn(&cr,p);
+                        bool ok = BitboardTerseIn(ponder,&cr,p);
                         if( ok )
                         {
                             gbl_ponder = ponder;
@@ -20,10 +20,10 @@ inline int64_t ftell64( FILE *file )
 
 #ifdef THC_UNIX
 inline int fseek64( FILE *file, int64_t fposn, int origin )
-    { return _fseeko( file, fposn, origin ); }
+    { return fseeko( file, fposn, origin ); }
 
 inline int64_t ftell64( FILE *file )
-    { return _ftello( file); }
+    { return ftello( file); }
 #endif
 
 #endif // FSEEK64_H_INCLUDED
@@ -792,6 +792,10 @@ public:
         void OnUpdateDatabasePattern(wxUpdateUIEvent &);
     void OnDatabaseMaterial(wxCommandEvent &);
         void OnUpdateDatabaseMaterial(wxUpdateUIEvent &);
+    void OnDatabaseNovelty(wxCommandEvent &);
+        void OnUpdateDatabaseNovelty(wxUpdateUIEvent &);
+    void OnDatabaseRepertoire(wxCommandEvent &);
+        void OnUpdateDatabaseRepertoire(wxUpdateUIEvent &);
     void OnTraining   (wxCommandEvent &);
         void OnUpdateTraining(wxUpdateUIEvent &);
     void OnGeneral    (wxCommandEvent &);
@@ -1240,6 +1244,10 @@ BEGIN_EVENT_TABLE(ChessFrame, wxFrame)
         EVT_UPDATE_UI (ID_DATABASE_PATTERN,             ChessFrame::OnUpdateDatabasePattern)
     EVT_MENU (ID_DATABASE_MATERIAL,                 ChessFrame::OnDatabaseMaterial)
         EVT_UPDATE_UI (ID_DATABASE_MATERIAL,            ChessFrame::OnUpdateDatabaseMaterial)
+    EVT_MENU (ID_DATABASE_NOVELTY,                  ChessFrame::OnDatabaseNovelty)
+        EVT_UPDATE_UI (ID_DATABASE_NOVELTY,             ChessFrame::OnUpdateDatabaseNovelty)
+    EVT_MENU (ID_DATABASE_REPERTOIRE,               ChessFrame::OnDatabaseRepertoire)
+        EVT_UPDATE_UI (ID_DATABASE_REPERTOIRE,          ChessFrame::OnUpdateDatabaseRepertoire)
     EVT_MENU (ID_DATABASE_MAINTENANCE,              ChessFrame::OnDatabaseMaintenance)
         EVT_UPDATE_UI (ID_DATABASE_MAINTENANCE,          ChessFrame::OnUpdateDatabaseMaintenance)
     EVT_MENU (ID_FILE_OPEN_SHELL,                    ChessFrame::OnFileOpenShell)   // Doesn't appear in any actual menu, used to open files from Windows Explorer
@@ -1355,6 +1363,8 @@ ChessFrame::ChessFrame(const wxString& title, const wxPoint& pos, const wxSize&
     menu_database->Append (ID_DATABASE_SEARCH,              "Position search", "Search the database for the current position");
     menu_database->Append (ID_DATABASE_PATTERN,             "Pattern search", "Search the database for situations where a group of pieces are at specific locations");
     menu_database->Append (ID_DATABASE_MATERIAL,            "Material balance search", "Search the database for a specific material balance, with optional locked down squares" );
+    menu_database->Append (ID_DATABASE_NOVELTY,             "Find novelty", "Count the database games reaching each position of the current game, to find where it leaves the database");
+    menu_database->Append (ID_DATABASE_REPERTOIRE,          "Repertoire coverage", "Annotate a copy of the current game and its variations with database game counts, and add popular moves it's missing");
     menu_database->Append (ID_DATABASE_SHOW_ALL,            "Show all games", "Show all database games - equivalent to searching for the standard starting position");
     menu_database->Append (ID_DATABASE_PLAYERS,             "Show all ordered by player", "Show all games ordered by White player, useful for searching for players");
     menu_database->Append (ID_DATABASE_SELECT,              "Select current database", "Specify which database file to use for searches");
@@ -2494,6 +2504,16 @@ void ChessFrame::OnDatabaseMaterial(wxCommandEvent &)
     objs.gl->CmdDatabaseMaterial();
 }
 
+void ChessFrame::OnDatabaseNovelty(wxCommandEvent &)
+{
+    objs.gl->CmdDatabaseNovelty();
+}
+
+void ChessFrame::OnDatabaseRepertoire(wxCommandEvent &)
+{
+    objs.gl->CmdDatabaseRepertoire();
+}
+
 void ChessFrame::OnUpdateDatabaseSearch(wxUpdateUIEvent &)
 {
 }
@@ -2526,6 +2546,14 @@ void ChessFrame::OnUpdateDatabaseMaterial(wxUpdateUIEvent &)
 {
 }
 
+void ChessFrame::OnUpdateDatabaseNovelty(wxUpdateUIEvent &)
+{
+}
+
+void ChessFrame::OnUpdateDatabaseRepertoire(wxUpdateUIEvent &)
+{
+}
+
 void ChessFrame::OnDatabaseMaintenance(wxCommandEvent &)
 {
     wxString old_file    = objs.repository->engine.m_file;
@@ -1,16 +1,1154 @@
-// tarrasch-test.cpp is in the new_heart branch only for now.
+/****************************************************************************
+ * tarrasch-test - Command line correctness tests and benchmarks for move
+ *  generation, move compression and in memory position search
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include "thc.h"
+#include "AutoTimer.h"
+#include "CompressMoves.h"
+#include "BitboardPosition.h"
+#include "SlimPosition.h"
+#include "ListableGame.h"
+#include "MemoryPositionSearch.h"
+#include "OpeningTree.h"
+#include "Repertoire.h"
 
-/*
+// The app defines these in main.cpp
+int AutoTimer::instance_cnt;
+AutoTimer *AutoTimer::instance_ptr;
+#ifndef KILL_DEBUG_COMPLETELY
+int core_printf( const char *fmt, ... )
+{
+    va_list args;
+    va_start( args, fmt );
+    int ret = vprintf( fmt, args );
+    va_end( args );
+    return ret;
+}
+#endif
+
+// A corpus game, position searching only needs the compressed moves
+class TestGame : public ListableGame
+{
+public:
+    TestGame( uint32_t id, const std::string &blob, bool has_promotion ) : blob(blob)
+    {
+        game_id = id;
+        SetPromotion( has_promotion );
+    }
+    virtual const char *CompressedMoves() { return blob.c_str(); }
+    virtual const char *Result() { return game_id%3==0 ? "1/2-1/2" : (game_id%3==1 ? "1-0" : "0-1"); }
+    virtual int WhiteEloBin() { return game_id%4==0 ? 0 : 2000 + game_id%200; }
+    virtual int BlackEloBin() { return game_id%4==0 ? 0 : 1900 + game_id%300; }
+    virtual int DateBin() { return ((1990 + game_id%30 - 1500)<<9) + (1+game_id%12)*32 + 1; }
+private:
+    std::string blob;
+};
+
+static double Seconds( std::chrono::steady_clock::time_point t0 )
+{
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
+}
+
+static double Rate( double count, double secs )
+{
+    return secs>0.0 ? count/secs : 0.0;
+}
+
+// Reproducible random games. Every second game prefers pawn moves, so that there
+//  are plenty of promotions (and slow mode compression) in the corpus
+static void MakeCorpus( int nbr_games, std::vector< std::vector<thc::Move> > &games )
+{
+    srand(1);
+    games.clear();
+    for( int i=0; i<nbr_games; i++ )
+    {
+        thc::ChessRules cr;
+        std::vector<thc::Move> moves;
+        int max_plies = 20 + rand()%280;
+        for( int ply=0; ply<max_plies; ply++ )
+        {
+            std::vector<thc::Move> list;
+            cr.GenLegalMoveList( list );
+            if( list.size() == 0 )
+                break;
+            thc::Move mv = list[ rand()%list.size() ];
+            for( int tries=0; (i&1) && tries<4; tries++ )
+            {
+                if( toupper(cr.squares[mv.src]) == 'P' )
+                    break;
+                mv = list[ rand()%list.size() ];
+            }
+            cr.PlayMove( mv );
+            moves.push_back( mv );
+        }
+        games.push_back( moves );
+    }
+}
+
+static bool HasPromotion( const std::vector<thc::Move> &moves )
+{
+    for( const thc::Move &mv: moves )
+    {
+        switch( mv.special )
+        {
+            case thc::SPECIAL_PROMOTION_QUEEN:
+            case thc::SPECIAL_PROMOTION_ROOK:
+            case thc::SPECIAL_PROMOTION_BISHOP:
+            case thc::SPECIAL_PROMOTION_KNIGHT:
+                return true;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+// Perft on standard positions, bitboard and thc move generators
+static bool TestPerft()
+{
+    printf( "\nPerft\n" );
+    return BitboardPerftBenchmark(4);
+}
+
+// Bitboard check detection, Evaluate(), TerseIn(), NaturalIn() and NaturalOut() against thc,
+//  for every move of the first nbr_games games
+static bool TestBitboardThc( const std::vector< std::vector<thc::Move> > &games, size_t nbr_games )
+{
+    printf( "\nBitboard check detection and move conversion\n" );
+    int nbr_bad = 0;
+    size_t nbr_moves = 0;
+    double secs_thc = 0.0;
+    double secs_bb  = 0.0;
+    for( size_t g=0; g<games.size() && g<nbr_games; g++ )
+    {
+        thc::ChessRules cr;
+        for( thc::Move mv: games[g] )
+        {
+            BitboardPosition bb(cr);
+            thc::TERMINAL terminal_thc, terminal_bb;
+            bool ok_thc = cr.Evaluate( terminal_thc );
+            bool ok_bb  = BitboardEvaluate( &cr, terminal_bb );
+            bool in_check = cr.AttackedPiece( cr.white ? cr.wking_square : cr.bking_square );
+            if( ok_thc!=ok_bb || terminal_thc!=terminal_bb || in_check!=bb.InCheck() )
+                nbr_bad++;
+
+            // Text conversions, thc then bitboard
+            thc::Move in_thc, in_bb, terse_thc, terse_bb;
+            auto t0 = std::chrono::steady_clock::now();
+            std::string san_thc = mv.NaturalOut( &cr );
+            bool have_thc = in_thc.NaturalIn( &cr, san_thc.c_str() );
+            have_thc = terse_thc.TerseIn( &cr, mv.TerseOut().c_str() ) && have_thc;
+            secs_thc += Seconds(t0);
+            t0 = std::chrono::steady_clock::now();
+            std::string san_bb = BitboardNaturalOut( mv, &cr );
+            bool have_bb = BitboardNaturalIn( in_bb, &cr, san_bb.c_str() );
+            have_bb = BitboardTerseIn( terse_bb, &cr, mv.TerseOut().c_str() ) && have_bb;
+            secs_bb += Seconds(t0);
+            if( san_thc!=san_bb || have_thc!=have_bb || in_thc!=in_bb || terse_thc!=terse_bb || in_bb!=mv )
+            {
+                if( nbr_bad++ < 5 )
+                    printf( "FAIL: %s %s thc %s bitboard %s\n", cr.ForsythPublish().c_str(),
+                                mv.TerseOut().c_str(), san_thc.c_str(), san_bb.c_str() );
+            }
+            cr.PlayMove( mv );
+            nbr_moves++;
+        }
+    }
+    bool ok = (nbr_bad == 0);
+    printf( "%s %u moves\n", ok?"OK  ":"FAIL", (unsigned)nbr_moves );
+    printf( "NaturalOut()+NaturalIn()+TerseIn(): bitboard %.0f moves/s, thc %.0f moves/s\n",
+                Rate(nbr_moves,secs_bb), Rate(nbr_moves,secs_thc) );
+    return ok;
+}
+
+// Compress() then Uncompress() every game, also check CompressMoves::Hash64Batch()
+//  against a thc replay
+static bool TestCompress( const std::vector< std::vector<thc::Move> > &games, std::vector<std::string> &blobs )
+{
+    printf( "\nCompress/Uncompress round trip\n" );
+    bool ok = true;
+    size_t nbr_moves = 0;
+    for( const std::vector<thc::Move> &moves: games )
+        nbr_moves += moves.size();
+
+    blobs.clear();
+    auto t0 = std::chrono::steady_clock::now();
+    for( const std::vector<thc::Move> &moves: games )
+    {
+        CompressMoves press;
+        std::vector<thc::Move> copy = moves;
+        blobs.push_back( press.Compress(copy) );
+    }
+    double secs_compress = Seconds(t0);
+
+    int nbr_bad = 0;
+    t0 = std::chrono::steady_clock::now();
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        CompressMoves press;
+        std::vector<thc::Move> moves = press.Uncompress( blobs[i] );
+        if( moves != games[i] )
+            nbr_bad++;
+    }
+    double secs_uncompress = Seconds(t0);
+    if( nbr_bad )
+    {
+        ok = false;
+        printf( "FAIL: %d games don't survive the round trip\n", nbr_bad );
+    }
+
+    // Batch hashing, compared with thc's own hash replaying each game
+    nbr_bad = 0;
+    double secs_hash = 0.0;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        std::vector<uint64_t> hashes;
+        CompressMoves press;
+        t0 = std::chrono::steady_clock::now();
+        press.Hash64Batch( blobs[i].c_str(), blobs[i].length(), hashes );
+        secs_hash += Seconds(t0);
+        thc::ChessRules cr;
+        bool match = (hashes.size() == games[i].size()+1);
+        for( size_t j=0; match && j<hashes.size(); j++ )
+        {
+            if( hashes[j] != cr.Hash64Calculate() )
+                match = false;
+            if( j < games[i].size() )
+                cr.PlayMove( games[i][j] );
+        }
+        if( !match )
+            nbr_bad++;
+    }
+    if( nbr_bad )
+    {
+        ok = false;
+        printf( "FAIL: %d games hash differently\n", nbr_bad );
+    }
+    printf( "%s %u games %u moves\n", ok?"OK  ":"FAIL", (unsigned)games.size(), (unsigned)nbr_moves );
+    printf( "Compress:   %.0f moves/s %.0f games/s\n", Rate(nbr_moves,secs_compress),   Rate(games.size(),secs_compress) );
+    printf( "Uncompress: %.0f moves/s %.0f games/s\n", Rate(nbr_moves,secs_uncompress), Rate(games.size(),secs_uncompress) );
+    printf( "Hash64Batch: %.0f moves/s %.0f games/s\n", Rate(nbr_moves,secs_hash), Rate(games.size(),secs_hash) );
+    return ok;
+}
+
+// Replay every game with SlimPosition, checking it stays in step with thc::ChessRules
+//  (position, counts and hash) and that PopMove() undoes PushMove(). Then time a
+//  replay that takes a copy of the position at every ply (as slow mode decoding and
+//  the database dialog's user move scan used to), thc::ChessRules against SlimPosition
+static const void * volatile sink;     // so the optimiser can't skip copies
+static bool TestSlimPosition( const std::vector< std::vector<thc::Move> > &games )
+{
+    printf( "\nSlimPosition replay\n" );
+    int nbr_bad = 0;
+    size_t nbr_moves = 0;
+    for( const std::vector<thc::Move> &moves: games )
+    {
+        thc::ChessRules cr;
+        SlimPosition slim;
+        uint64_t hash = slim.Hash64Calculate();
+        bool match = true;
+        for( size_t i=0; match && i<moves.size(); i++ )
+        {
+            hash = slim.Hash64Update( hash, moves[i] );
+            SlimPosition before = slim;
+            slim.PushMove( moves[i] );
+            slim.PopMove( moves[i] );
+            if( 0 != memcmp(&before,&slim,sizeof(thc::ChessPositionRaw)) )
+                match = false;
+            cr.PlayMove( moves[i] );
+            slim.PlayMove( moves[i] );
+            if( slim!=cr || hash!=cr.Hash64Calculate() || slim.Hash64Calculate()!=hash ||
+                slim.half_move_clock!=cr.half_move_clock || slim.full_move_count!=cr.full_move_count )
+                match = false;
+        }
+        nbr_moves += moves.size();
+        if( !match )
+            nbr_bad++;
+    }
+    bool ok = (nbr_bad == 0);
+    if( !ok )
+        printf( "FAIL: %d games replay differently\n", nbr_bad );
+
+    int passes = 20;
+    thc::ChessRules start_cr;
+    SlimPosition start_slim;
+    auto t0 = std::chrono::steady_clock::now();
+    for( int pass=0; pass<passes; pass++ )
+    {
+        for( const std::vector<thc::Move> &moves: games )
+        {
+            thc::ChessRules cr = start_cr;
+            for( const thc::Move &mv: moves )
+            {
+                thc::ChessRules before = cr;
+                sink = &before;
+                cr.PlayMove( mv );
+            }
+        }
+    }
+    double secs_cr = Seconds(t0);
+    t0 = std::chrono::steady_clock::now();
+    for( int pass=0; pass<passes; pass++ )
+    {
+        for( const std::vector<thc::Move> &moves: games )
+        {
+            SlimPosition slim = start_slim;
+            for( const thc::Move &mv: moves )
+            {
+                SlimPosition before = slim;
+                sink = &before;
+                slim.PlayMove( mv );
+            }
+        }
+    }
+    double secs_slim = Seconds(t0);
+    double nbr_replayed = static_cast<double>(games.size()) * passes;
+    printf( "%s %u games %u moves (%u bytes copied per ply, thc::ChessRules %u bytes)\n", ok?"OK  ":"FAIL",
+                (unsigned)games.size(), (unsigned)nbr_moves, (unsigned)sizeof(SlimPosition), (unsigned)sizeof(thc::ChessRules) );
+    printf( "Replay: SlimPosition %.0f games/s, thc::ChessRules %.0f games/s\n",
+                Rate(nbr_replayed,secs_slim), Rate(nbr_replayed,secs_cr) );
+    return ok;
+}
+
+// MemoryPositionSearch::DoSearch() for positions taken from the corpus, compared with
+//  finding the first occurrence of each position by replaying every game with thc
+static bool TestSearch( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    printf( "\nPosition search\n" );
+    std::vector< smart_ptr<ListableGame> > source;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        smart_ptr<ListableGame> p( new TestGame( static_cast<uint32_t>(i+1), blobs[i], HasPromotion(games[i]) ) );
+        source.push_back( p );
+    }
+
+    // Some early (so usually found in many games), middle and late targets
+    std::vector<thc::ChessPosition> targets;
+    for( size_t i=0; i<games.size() && targets.size()<30; i+=games.size()/30+1 )
+    {
+        size_t len = games[i].size();
+        size_t ply = targets.size()%3==0 ? (len<2?len:2) : (targets.size()%3==1 ? len/2 : len);
+        thc::ChessRules cr;
+        for( size_t j=0; j<ply; j++ )
+            cr.PlayMove( games[i][j] );
+        targets.push_back( cr );
+    }
+
+    bool ok = true;
+    int nbr_found = 0;
+    int nbr_transpositions = 0;
+    double secs_mps = 0.0;
+    double secs_replay = 0.0;
+    MemoryPositionSearch mps;
+    for( thc::ChessPosition &target: targets )
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        mps.DoSearch( target, NULL, &source );
+        secs_mps += Seconds(t0);
+        std::vector<DoSearchFoundGame> &found = mps.GetVectorGamesFound();
+
+        // The brute force way
+        t0 = std::chrono::steady_clock::now();
+        std::vector<DoSearchFoundGame> expected;
+        for( size_t i=0; i<games.size(); i++ )
+        {
+            thc::ChessRules cr;
+            for( size_t ply=0; ply<=games[i].size(); ply++ )
+            {
+                if( ply > 0 )
+                    cr.PlayMove( games[i][ply-1] );
+                if( cr.white==target.white && 0==memcmp(cr.squares,target.squares,64) )
+                {
+                    DoSearchFoundGame dsfg;
+                    dsfg.idx = static_cast<int>(i);
+                    dsfg.game_id = static_cast<uint32_t>(i+1);
+                    dsfg.offset_first = dsfg.offset_last = static_cast<unsigned short>(ply);
+                    expected.push_back( dsfg );
+                    break;
+                }
+            }
+        }
+        secs_replay += Seconds(t0);
+        bool match = (found.size() == expected.size());
+        for( size_t j=0; match && j<found.size(); j++ )
+        {
+            if( found[j].idx!=expected[j].idx || found[j].game_id!=expected[j].game_id ||
+                found[j].offset_first!=expected[j].offset_first )
+                match = false;
+        }
+        if( !match )
+        {
+            ok = false;
+            printf( "FAIL: %s found in %u games, expected %u\n", target.ForsythPublish().c_str(),
+                        (unsigned)found.size(), (unsigned)expected.size() );
+        }
+        nbr_found += static_cast<int>(found.size());
+
+        // The same search shared out to threads, gathering stats as it goes, compared
+        //  with stats worked out from the expected games
+        std::map<std::string,int> paths;
+        std::map<char,int> next_moves;
+        int white_wins=0, black_wins=0, draws=0;
+        for( DoSearchFoundGame &dsfg: expected )
+        {
+            const std::string &blob = blobs[dsfg.idx];
+            paths[ blob.substr(0,dsfg.offset_first) ]++;
+            if( dsfg.offset_first < blob.length() )
+                next_moves[ blob[dsfg.offset_first] ]++;
+            std::string result = source[dsfg.idx]->Result();
+            if( result == "1-0" )
+                white_wins++;
+            else if( result == "0-1" )
+                black_wins++;
+            else
+                draws++;
+        }
+        mps.SetThreads( 4 );
+        mps.DoSearch( target, NULL, &source, true );
+        mps.SetThreads( 0 );
+        PositionStats &ps = mps.GetPositionStats();
+        match = ( mps.HavePositionStats() && mps.GetVectorGamesFound().size()==expected.size() &&
+                  ps.total_white_wins==white_wins && ps.total_black_wins==black_wins && ps.total_draws==draws &&
+                  ps.transpositions.size()==paths.size() && ps.stats.size()==next_moves.size() );
+        for( size_t j=0; match && j<ps.transpositions.size(); j++ )
+        {
+            if( paths[ps.transpositions[j].blob] != ps.transpositions[j].frequency ||
+                (j>0 && ps.transpositions[j-1].frequency<ps.transpositions[j].frequency) )
+                match = false;
+        }
+        for( const std::pair<const char,int> &kv: next_moves )
+        {
+            if( match && ps.stats[kv.first].nbr_games != kv.second )
+                match = false;
+        }
+        for( size_t j=0; match && j<expected.size(); j++ )
+        {
+            size_t len = 0;
+            int idx = ps.FindTransposition( blobs[expected[j].idx].c_str(), len );
+            if( idx<0 || len!=expected[j].offset_first )
+                match = false;
+        }
+        if( !match )
+        {
+            ok = false;
+            printf( "FAIL: %s stats don't match (%u transpositions, expected %u)\n", target.ForsythPublish().c_str(),
+                        (unsigned)ps.transpositions.size(), (unsigned)paths.size() );
+        }
+        nbr_transpositions += static_cast<int>(ps.transpositions.size());
+
+        // The same search a few games at a time, the games found at each step are the
+        //  first games of the complete search
+        mps.SetThreads( 4 );
+        mps.DoSearchStart( target, &source, true );
+        for( int wanted=1; match && !mps.IsSearchComplete(); wanted*=2 )
+        {
+            int n = mps.DoSearchContinue( wanted );
+            std::vector<DoSearchFoundGame> &some = mps.GetVectorGamesFound();
+            if( (n<wanted && !mps.IsSearchComplete()) || n>static_cast<int>(expected.size()) ||
+                mps.HavePositionStats()!=mps.IsSearchComplete() )
+                match = false;
+            for( int j=0; match && j<n; j++ )
+            {
+                if( some[j].idx != expected[j].idx )
+                    match = false;
+            }
+        }
+        mps.SetThreads( 0 );
+        if( match && (mps.GetVectorGamesFound().size()!=expected.size() || !mps.HavePositionStats() ||
+                      mps.GetPositionStats().transpositions.size()!=paths.size() ||
+                      mps.GetPositionStats().total_white_wins!=white_wins) )
+            match = false;
+        if( !match )
+        {
+            ok = false;
+            printf( "FAIL: %s a few games at a time doesn't match the complete search\n", target.ForsythPublish().c_str() );
+        }
+    }
+    double nbr_searched = static_cast<double>(games.size()) * targets.size();
+    printf( "%s %u searches, %d games found, %d transpositions\n", ok?"OK  ":"FAIL", (unsigned)targets.size(), nbr_found, nbr_transpositions );
+    printf( "DoSearch: %.0f games/s (thc replay %.0f games/s)\n",
+                Rate(nbr_searched,secs_mps), Rate(nbr_searched,secs_replay) );
+    return ok;
+}
+
+// CompressMoves::MaterialSpans(), compared with the material of every position as the
+//  game is replayed with thc
+static bool TestMaterialSpans( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    bool ok = true;
+    size_t nbr_spans = 0;
+    for( size_t i=0; ok && i<games.size(); i++ )
+    {
+        CompressMoves press;
+        std::vector<MaterialSpan> spans;
+        press.MaterialSpans( blobs[i].c_str(), blobs[i].length(), spans );
+        nbr_spans += spans.size();
+        thc::ChessRules cr;
+        size_t k = 0;
+        for( size_t ply=0; ok && ply<=games[i].size(); ply++ )
+        {
+            if( ply > 0 )
+                cr.PlayMove( games[i][ply-1] );
+            while( k<spans.size() && spans[k].last_ply<ply )
+                k++;
+            if( k>=spans.size() || spans[k].first_ply>ply || spans[k].signature!=MaterialSignature(cr.squares) )
+            {
+                ok = false;
+                printf( "FAIL: game %u ply %u, material span doesn't match\n", (unsigned)i, (unsigned)ply );
+            }
+        }
+    }
+    printf( "%s %u games, %u material spans\n", ok?"OK  ":"FAIL", (unsigned)games.size(), (unsigned)nbr_spans );
+    return ok;
+}
+
+// CompressMoves::PawnSpans(), compared with the pawn structure of every position as the
+//  game is replayed with thc
+static bool TestPawnSpans( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    bool ok = true;
+    size_t nbr_spans = 0;
+    for( size_t i=0; ok && i<games.size(); i++ )
+    {
+        CompressMoves press;
+        std::vector<PawnSpan> spans;
+        press.PawnSpans( blobs[i].c_str(), blobs[i].length(), spans );
+        nbr_spans += spans.size();
+        thc::ChessRules cr;
+        size_t k = 0;
+        for( size_t ply=0; ok && ply<=games[i].size(); ply++ )
+        {
+            if( ply > 0 )
+                cr.PlayMove( games[i][ply-1] );
+            while( k<spans.size() && spans[k].last_ply<ply )
+                k++;
+            if( k>=spans.size() || spans[k].first_ply>ply || spans[k].hash!=PawnStructureHash(cr.squares) )
+            {
+                ok = false;
+                printf( "FAIL: game %u ply %u, pawn span doesn't match\n", (unsigned)i, (unsigned)ply );
+            }
+        }
+    }
+    printf( "%s %u games, %u pawn structure spans\n", ok?"OK  ":"FAIL", (unsigned)games.size(), (unsigned)nbr_spans );
+    return ok;
+}
+
+// MemoryPositionSearch::DoPatternSearch() shared out to several threads, compared with
+//  a single threaded search (same games found in the same order, same stats)
+static bool TestPatternSearch( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    printf( "\nPattern search\n" );
+    std::vector< smart_ptr<ListableGame> > source;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        smart_ptr<ListableGame> p( new TestGame( static_cast<uint32_t>(i+1), blobs[i], HasPromotion(games[i]) ) );
+        source.push_back( p );
+    }
+    bool ok = true;
+    int nbr_found = 0;
+    int nbr_searches = 0;
+    int nbr_indexed_searches = 0;
+    double secs_single = 0.0;
+    double secs_multi  = 0.0;
+    double secs_indexed = 0.0;
+    double secs_unindexed = 0.0;
+    MemoryPositionSearch mps;
+    const char *mode_names[] = { "pattern", "material balance", "pawn structure" };
+    for( size_t i=0; i<games.size() && nbr_searches<36; i+=games.size()/6+1 )
+    {
+        for( int target=0; target<6; target++ )
+        {
+            // Early and late (usually endgame) positions, pattern, material balance and
+            //  pawn structure
+            int mode = target%3;
+            size_t len = games[i].size();
+            thc::ChessRules cr;
+            for( size_t j=0; j < (target<3 ? std::min<size_t>(len,12) : len-len/4); j++ )
+                cr.PlayMove( games[i][j] );
+            PatternMatch pm;
+            pm.parm.OneTimeInit( mode==1, cr );
+            pm.parm.pawn_structure = (mode==2);
+            pm.parm.include_reflections = pm.parm.include_reverse_colours = pm.parm.either_to_move = true;
+            PATTERN_STATS stats_single, stats_multi;
+            mps.SetThreads( 1 );
+            auto t0 = std::chrono::steady_clock::now();
+            mps.DoPatternSearch( pm, NULL, stats_single, &source );
+            secs_single += Seconds(t0);
+            std::vector<DoSearchFoundGame> single = mps.GetVectorGamesFound();
+            mps.SetThreads( 4 );
+            t0 = std::chrono::steady_clock::now();
+            mps.DoPatternSearch( pm, NULL, stats_multi, &source );
+            secs_multi += Seconds(t0);
+            std::vector<DoSearchFoundGame> &multi = mps.GetVectorGamesFound();
+            bool match = ( single.size()==multi.size() &&
+                           stats_single.nbr_games==stats_multi.nbr_games &&
+                           stats_single.nbr_reversed_games==stats_multi.nbr_reversed_games &&
+                           stats_single.draws==stats_multi.draws );
+            for( size_t j=0; match && j<single.size(); j++ )
+            {
+                if( single[j].idx!=multi[j].idx || single[j].offset_first!=multi[j].offset_first ||
+                    single[j].offset_last!=multi[j].offset_last )
+                    match = false;
+            }
+            if( !match )
+            {
+                ok = false;
+                printf( "FAIL: %s %s found in %u games with 4 threads, %u with 1\n", mode_names[mode],
+                            cr.ForsythPublish().c_str(), (unsigned)multi.size(), (unsigned)single.size() );
+            }
+
+            // Material balance and pawn structure searches use the games' material signature
+            //  and pawn structure indexes (built by the first search), check against testing
+            //  every ply of every game
+            if( mode != 0 )
+            {
+                t0 = std::chrono::steady_clock::now();
+                mps.DoPatternSearch( pm, NULL, stats_multi, &source );
+                secs_indexed += Seconds(t0);
+                t0 = std::chrono::steady_clock::now();
+                std::vector<DoSearchFoundGame> unindexed;
+                for( size_t j=0; j<source.size(); j++ )
+                {
+                    DoSearchFoundGame dsfg;
+                    bool reverse;
+                    pm.NewGame();
+                    if( mps.PatternSearchGameSlowPromotionAllowed( pm, reverse, blobs[j], dsfg.offset_first, dsfg.offset_last ) )
+                    {
+                        dsfg.idx = static_cast<int>(j);
+                        unindexed.push_back( dsfg );
+                    }
+                }
+                secs_unindexed += Seconds(t0);
+                match = ( single.size()==unindexed.size() );
+                for( size_t j=0; match && j<single.size(); j++ )
+                {
+                    if( single[j].idx!=unindexed[j].idx || single[j].offset_first!=unindexed[j].offset_first )
+                        match = false;
+                }
+                if( !match )
+                {
+                    ok = false;
+                    printf( "FAIL: %s %s found in %u games, %u without the index\n", mode_names[mode],
+                                cr.ForsythPublish().c_str(), (unsigned)single.size(), (unsigned)unindexed.size() );
+                }
+                nbr_indexed_searches++;
+            }
+            nbr_found += static_cast<int>(single.size());
+            nbr_searches++;
+        }
+    }
+    double nbr_searched = static_cast<double>(games.size()) * nbr_searches;
+    double nbr_indexed_searched = static_cast<double>(games.size()) * nbr_indexed_searches;
+    printf( "%s %d searches, %d games found\n", ok?"OK  ":"FAIL", nbr_searches, nbr_found );
+    printf( "DoPatternSearch: 1 thread %.0f games/s, 4 threads %.0f games/s\n",
+                Rate(nbr_searched,secs_single), Rate(nbr_searched,secs_multi) );
+    printf( "Material balance and pawn structure: indexed %.0f games/s, every ply %.0f games/s\n",
+                Rate(nbr_indexed_searched,secs_indexed), Rate(nbr_indexed_searched,secs_unindexed) );
+    return ok;
+}
 
-The tarrasch-test project is specific to the new_heart branch, once new_heart is
-ready I'll bring it into master branch
+// DoSearch() and DoPatternSearch() with a game filter, compared with unfiltered searches
+//  with the games that fail the filter removed afterwards
+static bool TestFilteredSearch( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    std::vector< smart_ptr<ListableGame> > source;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        smart_ptr<ListableGame> p( new TestGame( static_cast<uint32_t>(i+1), blobs[i], HasPromotion(games[i]) ) );
+        source.push_back( p );
+    }
+    MpsFilter filter;
+    filter.min_elo = 2050;
+    filter.min_date = Date2Bin("2000.??.??");
+    filter.max_date = Date2Bin("2010.12.31");
+    filter.result_mask = (1<<1) | (1<<3);   // white wins and draws
+    bool ok = true;
+    int nbr_searches = 0;
+    int nbr_found = 0;
+    MemoryPositionSearch mps;
+    mps.SetThreads( 4 );
+    for( size_t i=0; i<games.size() && nbr_searches<20; i+=games.size()/10+1 )
+    {
+        for( int target=0; target<2; target++ )
+        {
+            // Positions early enough to be found in plenty of games
+            thc::ChessRules cr;
+            for( size_t j=0; j<std::min<size_t>(games[i].size(),target?4:nbr_searches%3); j++ )
+                cr.PlayMove( games[i][j] );
+            std::vector<DoSearchFoundGame> expected, found;
+            PATTERN_STATS stats;
+            PatternMatch pm;
+            pm.parm.OneTimeInit( false, cr );
+            pm.parm.include_reflections = pm.parm.include_reverse_colours = pm.parm.either_to_move = true;
+            mps.SetFilter( MpsFilter() );
+            if( target == 0 )
+                mps.DoSearch( cr, NULL, &source );
+            else
+                mps.DoPatternSearch( pm, NULL, stats, &source );
+            for( DoSearchFoundGame &dsfg: mps.GetVectorGamesFound() )
+            {
+                ListableGame *p = source[dsfg.idx].get();
+                if( p->WhiteEloBin()>=filter.min_elo && p->BlackEloBin()>=filter.min_elo &&
+                    (uint32_t)p->DateBin()>=filter.min_date && (uint32_t)p->DateBin()<=filter.max_date &&
+                    ((filter.result_mask>>p->ResultBin())&1) )
+                    expected.push_back( dsfg );
+            }
+            mps.SetFilter( filter );
+            if( mps.IsThisSearchPosition(cr) )
+            {
+                ok = false;
+                printf( "FAIL: search results still current after the filter changed\n" );
+            }
+            if( target == 0 )
+                mps.DoSearch( cr, NULL, &source );
+            else
+                mps.DoPatternSearch( pm, NULL, stats, &source );
+            found = mps.GetVectorGamesFound();
+            bool match = (found.size() == expected.size());
+            for( size_t j=0; match && j<found.size(); j++ )
+            {
+                if( found[j].idx!=expected[j].idx || found[j].offset_first!=expected[j].offset_first )
+                    match = false;
+            }
+            if( !match )
+            {
+                ok = false;
+                printf( "FAIL: %s filtered %s found in %u games, expected %u\n", target?"pattern":"position",
+                            cr.ForsythPublish().c_str(), (unsigned)found.size(), (unsigned)expected.size() );
+            }
+            nbr_found += static_cast<int>(found.size());
+            nbr_searches++;
+        }
+    }
+    printf( "%s %d filtered searches, %d games found\n", ok?"OK  ":"FAIL", nbr_searches, nbr_found );
+    return ok;
+}
+
+// OpeningTree::Build(), compared with counts of first occurrences of every position as
+//  the games are replayed with thc, then saved and loaded again
+static bool TestOpeningTree( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    const int depth = 8;
+    const int min_games = 3;
+    std::vector< smart_ptr<ListableGame> > source;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        smart_ptr<ListableGame> p( new TestGame( static_cast<uint32_t>(i+1), blobs[i], HasPromotion(games[i]) ) );
+        source.push_back( p );
+    }
+    struct RefPosition
+    {
+        thc::ChessPosition cp;
+        int nbr_games, white_wins, draws, black_wins, nbr_within_depth;
+        std::map<int,OpeningTreeMove> moves;     // move counts, elo totals in average_elo
+        std::map<int,int> nbr_rated;
+    };
+    std::map<uint64_t,RefPosition> ref;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        int result = source[i]->ResultBin();
+        int white_elo = source[i]->WhiteEloBin();
+        int black_elo = source[i]->BlackEloBin();
+        thc::ChessRules cr;
+        std::vector<uint64_t> seen;
+        for( size_t ply=0; ply<=games[i].size() && ply<=2*depth; ply++ )
+        {
+            if( ply > 0 )
+                cr.PlayMove( games[i][ply-1] );
+            uint64_t key = Hash64Key( cr.Hash64Calculate(), cr.white );
+            if( std::find(seen.begin(),seen.end(),key) != seen.end() )
+                continue;
+            seen.push_back( key );
+            bool fresh = (ref.count(key)==0);
+            RefPosition &rp = ref[key];
+            if( fresh )
+            {
+                rp.cp = cr;
+                rp.nbr_games = rp.white_wins = rp.draws = rp.black_wins = rp.nbr_within_depth = 0;
+            }
+            rp.nbr_games++;
+            if( ply <= depth )
+                rp.nbr_within_depth++;
+            rp.white_wins += (result==1);
+            rp.black_wins += (result==2);
+            rp.draws      += (result==3);
+            if( ply < games[i].size() )
+            {
+                thc::Move mv = games[i][ply];
+                int idx = mv.src*64*16 + mv.dst*16 + mv.special;
+                OpeningTreeMove &m = rp.moves[idx];
+                if( m.nbr_games == 0 )
+                    m = OpeningTreeMove();
+                m.move = mv;
+                m.nbr_games++;
+                m.white_wins += (result==1);
+                m.black_wins += (result==2);
+                m.draws      += (result==3);
+                if( white_elo>0 && black_elo>0 )
+                {
+                    m.average_elo += white_elo+black_elo;
+                    rp.nbr_rated[idx]++;
+                }
+            }
+        }
+    }
+
+    OpeningTree tree;
+    int permill = 0;
+    bool kill = false;
+    auto t0 = std::chrono::steady_clock::now();
+    bool ok = tree.Build( source, depth, min_games, permill, kill );
+    double secs = Seconds(t0);
+    if( !ok )
+        printf( "FAIL: opening tree build didn't complete\n" );
+    std::string filename = "tarrasch-test-tree.tmp";
+    std::string error_msg;
+    OpeningTree loaded;
+    if( ok && tree.Save(filename,error_msg) )
+    {
+        ok = false;
+        printf( "FAIL: %s\n", error_msg.c_str() );
+    }
+    if( ok && !loaded.Load(filename,games.size()+1,depth,min_games,error_msg) )
+    {
+        ok = false;
+        printf( "FAIL: opening tree loaded for the wrong number of games\n" );
+    }
+    if( ok && loaded.Load(filename,games.size(),depth,min_games,error_msg) )
+    {
+        ok = false;
+        printf( "FAIL: %s\n", error_msg.c_str() );
+    }
+    remove( filename.c_str() );
+    size_t nbr_positions = 0;
+    for( int pass=0; ok && pass<2; pass++ )
+    {
+        OpeningTree &t = pass==0 ? tree : loaded;
+        nbr_positions = 0;
+        for( auto it=ref.begin(); ok && it!=ref.end(); it++ )
+        {
+            RefPosition &rp = it->second;
+            const OpeningTreePosition *pos = t.Lookup( rp.cp );
+            bool expected = (rp.nbr_within_depth >= min_games);
+            if( expected != (pos!=NULL) )
+            {
+                ok = false;
+                printf( "FAIL: position %s %s in opening tree\n", rp.cp.ForsythPublish().c_str(), expected?"missing":"unexpected" );
+                break;
+            }
+            if( !pos )
+                continue;
+            nbr_positions++;
+            if( pos->nbr_games!=(uint32_t)rp.nbr_games || pos->white_wins!=(uint32_t)rp.white_wins ||
+                pos->draws!=(uint32_t)rp.draws || pos->black_wins!=(uint32_t)rp.black_wins || pos->nbr_moves!=rp.moves.size() )
+            {
+                ok = false;
+                printf( "FAIL: position %s, opening tree counts don't match\n", rp.cp.ForsythPublish().c_str() );
+                break;
+            }
+            const OpeningTreeMove *moves = t.Moves( pos );
+            for( uint32_t j=0; ok && j<pos->nbr_moves; j++ )
+            {
+                const OpeningTreeMove &m = moves[j];
+                int idx = m.move.src*64*16 + m.move.dst*16 + m.move.special;
+                auto r = rp.moves.find(idx);
+                uint32_t average_elo = 0;
+                if( r != rp.moves.end() && rp.nbr_rated[idx] )
+                    average_elo = r->second.average_elo / (2*rp.nbr_rated[idx]);
+                if( r==rp.moves.end() || m.nbr_games!=r->second.nbr_games || m.white_wins!=r->second.white_wins ||
+                    m.draws!=r->second.draws || m.black_wins!=r->second.black_wins || m.average_elo!=average_elo ||
+                    (j>0 && moves[j-1].nbr_games<m.nbr_games) )
+                {
+                    ok = false;
+                    printf( "FAIL: position %s, opening tree move %u doesn't match\n", rp.cp.ForsythPublish().c_str(), j );
+                }
+            }
+        }
+    }
+    printf( "%s %u games, %u opening tree positions, built in %.3fs\n", ok?"OK  ":"FAIL",
+            (unsigned)games.size(), (unsigned)nbr_positions, secs );
+    return ok;
+}
+
+// Batch search every position of a few games, check against a replay of every game
+static bool TestBatchSearch( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    std::vector< smart_ptr<ListableGame> > source;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        smart_ptr<ListableGame> p( new TestGame( static_cast<uint32_t>(i+1), blobs[i], HasPromotion(games[i]) ) );
+        source.push_back( p );
+    }
+    std::vector<thc::ChessPosition> targets;
+    for( size_t i=0; i<games.size() && i<4; i++ )
+    {
+        thc::ChessRules cr;
+        targets.push_back( cr );    // the initial position is in every game, and a duplicate target
+        for( size_t ply=0; ply<games[i].size() && ply<40; ply++ )
+        {
+            cr.PlayMove( games[i][ply] );
+            targets.push_back( cr );
+        }
+    }
+
+    // Reference, the first ply each target key occurs in each game
+    std::map<uint64_t,size_t> keys;
+    for( size_t t=0; t<targets.size(); t++ )
+    {
+        thc::ChessPosition temp = targets[t];
+        keys.insert( std::make_pair(Hash64Key(temp.Hash64Calculate(),temp.white),t) );
+    }
+    std::vector< std::vector<DoSearchFoundGame> > ref( targets.size() );
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        thc::ChessRules cr;
+        std::vector<uint64_t> seen;
+        for( size_t ply=0; ply<=games[i].size(); ply++ )
+        {
+            if( ply > 0 )
+                cr.PlayMove( games[i][ply-1] );
+            uint64_t key = Hash64Key( cr.Hash64Calculate(), cr.white );
+            if( keys.count(key)==0 || std::find(seen.begin(),seen.end(),key)!=seen.end() )
+                continue;
+            seen.push_back( key );
+            DoSearchFoundGame dsfg;
+            dsfg.idx = static_cast<int>(i);
+            dsfg.game_id = source[i]->game_id;
+            dsfg.offset_first = dsfg.offset_last = static_cast<unsigned short>(ply);
+            ref[ keys[key] ].push_back( dsfg );
+        }
+    }
 
-(This placeholder allows tarrach-test.vcxproj to exist in the master branch)
+    MemoryPositionSearch mps;
+    std::vector<MpsBatchResult> results;
+    auto t0 = std::chrono::steady_clock::now();
+    int total = mps.DoBatchSearch( targets, NULL, results, &source, true );
+    double secs = Seconds(t0);
+    bool ok = (results.size()==targets.size());
+    int ref_total = 0;
+    for( size_t t=0; ok && t<targets.size(); t++ )
+    {
+        thc::ChessPosition temp = targets[t];
+        const std::vector<DoSearchFoundGame> &r = ref[ keys[Hash64Key(temp.Hash64Calculate(),temp.white)] ];
+        const std::vector<DoSearchFoundGame> &v = results[t].games_found;
+        const PositionStats &s = results[t].stats;
+        ref_total += r.size();
+        bool match = (v.size()==r.size()) &&
+                     (s.total_white_wins+s.total_black_wins+s.total_draws <= static_cast<int>(v.size()));
+        for( size_t j=0; match && j<v.size(); j++ )
+            match = v[j].idx==r[j].idx && v[j].game_id==r[j].game_id && v[j].offset_first==r[j].offset_first;
+        if( !match )
+        {
+            ok = false;
+            printf( "FAIL: batch search target %u (%s), %u games found, %u expected\n", (unsigned)t,
+                    targets[t].ForsythPublish().c_str(), (unsigned)v.size(), (unsigned)r.size() );
+        }
+    }
+    if( ok && total!=ref_total )
+    {
+        ok = false;
+        printf( "FAIL: batch search total %d, %d expected\n", total, ref_total );
+    }
 
-*/
+    // Compare with a DoSearch() per target
+    t0 = std::chrono::steady_clock::now();
+    for( size_t t=0; t<targets.size(); t++ )
+        mps.DoSearch( targets[t], NULL, &source, true );
+    double secs_each = Seconds(t0);
+    printf( "%s %u targets, %d games found, batch search %.3fs, searched one at a time %.3fs\n", ok?"OK  ":"FAIL",
+            (unsigned)targets.size(), total, secs, secs_each );
+    return ok;
+}
+
+// A repertoire of a few lines from the corpus, check its coverage against a replay of every game
+static bool TestRepertoire( const std::vector< std::vector<thc::Move> > &games, const std::vector<std::string> &blobs )
+{
+    const int min_games = 3;
+    const int min_percent = 1;
+    std::vector< smart_ptr<ListableGame> > source;
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        smart_ptr<ListableGame> p( new TestGame( static_cast<uint32_t>(i+1), blobs[i], HasPromotion(games[i]) ) );
+        source.push_back( p );
+    }
+
+    // Main line from the first game, a variation from a game with another first
+    //  move and one from a game with the same first move but another reply
+    thc::ChessPosition start;
+    MoveTree tree;
+    tree.Init( start );
+    auto line = [&]( size_t game, size_t first, size_t last )
+    {
+        VARIATION variation;
+        for( size_t ply=first; ply<last && ply<games[game].size(); ply++ )
+        {
+            MoveTree node;
+            node.game_move.move = games[game][ply];
+            variation.push_back( node );
+        }
+        return variation;
+    };
+    tree.variations[0] = line( 0, 0, 12 );
+    for( size_t i=1; i<games.size(); i++ )
+    {
+        if( games[i][0] != games[0][0] )
+        {
+            tree.variations[0][0].variations.push_back( line(i,0,6) );
+            break;
+        }
+    }
+    for( size_t i=1; i<games.size(); i++ )
+    {
+        if( games[i][0]==games[0][0] && games[i][1]!=games[0][1] )
+        {
+            tree.variations[0][1].variations.push_back( line(i,1,8) );
+            break;
+        }
+    }
+
+    MemoryPositionSearch mps;
+    RepertoireCoverage rc;
+    auto t0 = std::chrono::steady_clock::now();
+    rc.Calculate( tree, mps, &source, NULL, min_games, min_percent );
+    double secs = Seconds(t0);
+    bool ok = (rc.nodes.size() > 12);
+    if( !ok )
+        printf( "FAIL: repertoire has %u moves\n", (unsigned)rc.nodes.size() );
+
+    // Reference, games reaching each position and the moves played next
+    struct RefPosition
+    {
+        int nbr_games;
+        std::map<int,int> next;     // move -> games
+    };
+    std::map<uint64_t,RefPosition> ref;
+    for( const RepertoirePosition &rp: rc.positions )
+    {
+        thc::ChessPosition temp = rp.cp;
+        RefPosition &r = ref[ Hash64Key(temp.Hash64Calculate(),temp.white) ];
+        r.nbr_games = 0;
+    }
+    for( size_t i=0; i<games.size(); i++ )
+    {
+        thc::ChessRules cr;
+        std::vector<uint64_t> seen;
+        for( size_t ply=0; ply<=games[i].size(); ply++ )
+        {
+            if( ply > 0 )
+                cr.PlayMove( games[i][ply-1] );
+            uint64_t key = Hash64Key( cr.Hash64Calculate(), cr.white );
+            auto it = ref.find(key);
+            if( it==ref.end() || std::find(seen.begin(),seen.end(),key)!=seen.end() )
+                continue;
+            seen.push_back( key );
+            it->second.nbr_games++;
+            if( ply < games[i].size() )
+            {
+                thc::Move mv = games[i][ply];
+                it->second.next[ mv.src*64*16 + mv.dst*16 + mv.special ]++;
+            }
+        }
+    }
+    int nbr_deviations = 0;
+    for( size_t i=0; ok && i<rc.positions.size(); i++ )
+    {
+        const RepertoirePosition &rp = rc.positions[i];
+        thc::ChessPosition temp = rp.cp;
+        const RefPosition &r = ref[ Hash64Key(temp.Hash64Calculate(),temp.white) ];
+        std::map<int,int> expected;
+        if( rp.repertoire_moves.size() )
+        {
+            for( const std::pair<const int,int> &m: r.next )
+            {
+                if( m.second>=min_games && m.second*100>=min_percent*r.nbr_games )
+                    expected.insert( m );
+            }
+            for( const thc::Move &mv: rp.repertoire_moves )
+                expected.erase( mv.src*64*16 + mv.dst*16 + mv.special );
+        }
+        bool match = (rp.nbr_games==r.nbr_games && rp.deviations.size()==expected.size());
+        for( size_t j=0; match && j<rp.deviations.size(); j++ )
+        {
+            const RepertoireMove &dev = rp.deviations[j];
+            auto it = expected.find( dev.move.src*64*16 + dev.move.dst*16 + dev.move.special );
+            match = it!=expected.end() && it->second==dev.ms.nbr_games &&
+                    (j==0 || rp.deviations[j-1].ms.nbr_games>=dev.ms.nbr_games);
+        }
+        nbr_deviations += expected.size();
+        if( !match )
+        {
+            ok = false;
+            printf( "FAIL: repertoire position %s, %d games %u deviations, expected %d games %u deviations\n",
+                    temp.ForsythPublish().c_str(), rp.nbr_games, (unsigned)rp.deviations.size(), r.nbr_games, (unsigned)expected.size() );
+        }
+    }
+
+    // Annotating adds a variation for each deviation
+    size_t nbr_nodes = rc.nodes.size();
+    rc.Annotate( tree );
+    std::vector<MOVE_TREE_NODE> nodes;
+    tree.Nodes( nodes );
+    if( ok && (nbr_deviations==0 || rc.nbr_deviations!=nbr_deviations || nodes.size()!=nbr_nodes+nbr_deviations || tree.game_move.comment.length()==0) )
+    {
+        ok = false;
+        printf( "FAIL: repertoire annotated with %u moves, expected %u\n", (unsigned)nodes.size(), (unsigned)(nbr_nodes+nbr_deviations) );
+    }
+    printf( "%s %u repertoire moves, %u positions, %d deviations in %.3fs\n", ok?"OK  ":"FAIL",
+            (unsigned)nbr_nodes, (unsigned)rc.positions.size(), nbr_deviations, secs );
+    return ok;
+}
 
-int main()
+int main( int argc, char *argv[] )
 {
-    return 0;
+    int nbr_games = 1000;
+    if( argc > 1 )
+        nbr_games = atoi(argv[1]);
+    if( nbr_games < 1 )
+    {
+        printf( "usage: tarrasch-test [number of corpus games, default 1000]\n" );
+        return 2;
+    }
+    extern void compress_temp_lookup_gen_function();
+    compress_temp_lookup_gen_function();
+    std::vector< std::vector<thc::Move> > games;
+    MakeCorpus( nbr_games, games );
+    bool ok = TestPerft();
+    if( !TestSlimPosition(games) )
+        ok = false;
+    if( !TestBitboardThc(games,200) )
+        ok = false;
+    std::vector<std::string> blobs;
+    if( !TestCompress( games, blobs ) )
+        ok = false;
+    if( !TestSearch( games, blobs ) )
+        ok = false;
+    if( !TestMaterialSpans( games, blobs ) )
+        ok = false;
+    if( !TestPawnSpans( games, blobs ) )
+        ok = false;
+    if( !TestPatternSearch( games, blobs ) )
+        ok = false;
+    if( !TestFilteredSearch( games, blobs ) )
+        ok = false;
+    if( !TestOpeningTree( games, blobs ) )
+        ok = false;
+    if( !TestBatchSearch( games, blobs ) )
+        ok = false;
+    if( !TestRepertoire( games, blobs ) )
+        ok = false;
+    printf( "\n%s\n", ok ? "All tests passed" : "*** TESTS FAILED ***" );
+    return ok ? 0 : 1;
 }
-    
\ No newline at end of file
@@ -0,0 +1,612 @@
+/****************************************************************************
+ * tarrasch-validate - Command line validator, replays every game of a PGN
+ *  or .tdb file on all available cores and reports illegal or truncated
+ *  games (with their file offsets) in a machine readable form
+ *  Author:  Bill Forster
+ *  License: MIT license. Full text of license is in associated file LICENSE
+ *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
+ ****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "thc.h"
+#include "CompressMoves.h"
+#include "BitboardPosition.h"
+#include "BinaryConversions.h"
+#include "PgnTokenizer.h"
+
+// The app defines this in DebugPrintf.cpp
+#ifndef KILL_DEBUG_COMPLETELY
+int core_printf( const char *fmt, ... )
+{
+    va_list args;
+    va_start( args, fmt );
+    int ret = vfprintf( stderr, fmt, args );
+    va_end( args );
+    return ret;
+}
+#endif
+
+#define VALIDATE_PGN_CHUNK      (4*1024*1024)   // PGN is handed to the workers in chunks about this big
+#define VALIDATE_TDB_BATCH      4096            // .tdb games handed to the workers at a time
+#define VALIDATE_MAX_PENDING    64              // batches queued ahead of the workers, bounds memory use
+
+// As BinDb.cpp, the .tdb layout is a compatibility header (whose size is at 0x0f0
+//  and whose last byte is the version), this file header, nbr_players + nbr_events
+//  + nbr_sites '\0' terminated strings, then for each game a fixed size bit packed
+//  header followed by its '\0' terminated compressed moves
+#define TDB_COMPATIBILITY_HEADER_SIZE 1200
+struct TdbFileHeader
+{
+    int32_t hdr_len;
+    int32_t nbr_players;
+    int32_t nbr_events;
+    int32_t nbr_sites;
+    int32_t nbr_games;
+    int32_t locked;
+};
+
+// One line of the report
+struct Problem
+{
+    uint64_t    offset;     // start of the game in the file
+    uint64_t    game;       // 1 based, filled in when batches are merged
+    int         ply;        // 1 based, 0 if the problem isn't with a particular move
+    const char  *reason;
+    std::string detail;
+};
+
+// A range of the file for one worker. Games are numbered within the batch until
+//  all the batches before it are known
+struct Batch
+{
+    size_t                  begin;
+    size_t                  end;
+    std::vector<size_t>     games;      // .tdb only, the offset of each game's header
+    uint64_t                nbr_games;
+    uint64_t                nbr_plies;
+    std::vector<Problem>    problems;   // game is the index within the batch
+};
+
+// Batches in file order, produced by the main thread as it finds game boundaries
+//  and consumed by the workers. Results stay in their batch so the report comes
+//  out in file order however the work was scheduled
+class BatchQueue
+{
+public:
+    BatchQueue() { next=0; finished=false; }
+    void Push( const Batch &b )
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        room.wait( lock, [this]{ return batches.size()-next < VALIDATE_MAX_PENDING; } );
+        batches.push_back(b);
+        work.notify_one();
+    }
+    void Finish()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        finished = true;
+        work.notify_all();
+    }
+    Batch *Pop()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        work.wait( lock, [this]{ return next<batches.size() || finished; } );
+        if( next >= batches.size() )
+            return NULL;
+        Batch *b = &batches[next++];    // deque elements don't move as we push_back()
+        room.notify_one();
+        return b;
+    }
+    std::deque<Batch> batches;
+private:
+    std::mutex              mtx;
+    std::condition_variable work;
+    std::condition_variable room;
+    size_t                  next;
+    bool                    finished;
+};
+
+static void AddProblem( Batch &b, size_t offset, int ply, const char *reason, const std::string &detail=std::string() )
+{
+    Problem p;
+    p.offset = offset;
+    p.game = b.nbr_games;
+    p.ply = ply;
+    p.reason = reason;
+    p.detail = detail;
+    b.problems.push_back(p);
+}
+
+/****************************************************************************
+ * PGN
+ ****************************************************************************/
+
+// A new game starts with a '[' at the start of a line, provided the last
+//  non blank line wasn't also a tag
+static bool PgnGameStart( const char *data, size_t posn )
+{
+    if( data[posn] != '[' )
+        return false;
+    if( posn == 0 )
+        return true;
+    if( data[posn-1] != '\n' )
+        return false;
+    size_t i = posn-1;
+    while( i>0 )
+    {
+        size_t line_end = i;
+        while( i>0 && data[i-1]!='\n' )
+            i--;
+        size_t j = i;
+        while( j<line_end && (data[j]==' ' || data[j]=='\t' || data[j]=='\r') )
+            j++;
+        if( j < line_end )
+            return data[j] != '[';
+        if( i == 0 )
+            break;
+        i--;
+    }
+    return true;
+}
+
+// The first game start at or after posn (len if there isn't one)
+static size_t PgnNextGame( const char *data, size_t len, size_t posn )
+{
+    while( posn < len )
+    {
+        if( PgnGameStart(data,posn) )
+            return posn;
+        const char *nl = static_cast<const char *>( memchr( data+posn, '\n', len-posn ) );
+        if( !nl )
+            break;
+        posn = (nl-data) + 1;
+    }
+    return len;
+}
+
+// The value of a [Name "Value"] tag, false if it's not the named tag
+static bool PgnTagValue( const PgnToken &tok, const char *name, std::string &value )
+{
+    const char *p = tok.txt+1;
+    const char *end = tok.txt+tok.len;
+    size_t name_len = strlen(name);
+    while( p<end && (*p==' ' || *p=='\t') )
+        p++;
+    if( static_cast<size_t>(end-p)<=name_len || 0!=memcmp(p,name,name_len) || (p[name_len]!=' ' && p[name_len]!='\t' && p[name_len]!='"') )
+        return false;
+    p += name_len;
+    const char *q = static_cast<const char *>( memchr( p, '"', end-p ) );
+    if( !q )
+        return false;
+    q++;
+    const char *r = q;
+    while( r<end && *r!='"' )
+        r++;
+    value.assign( q, r-q );
+    return true;
+}
+
+// Replay every game in a PGN batch
+static void PgnValidate( const char *data, Batch &b )
+{
+    PgnTokenizer tz( data+b.begin, b.end-b.begin, true, true );
+    PgnToken tok;
+    thc::ChessRules cr;
+    bool   in_game = false;     // seen anything of the game yet
+    bool   movetext = false;    // seen anything after the tags
+    bool   complete = false;    // seen the result
+    bool   failed = false;      // stop replaying after the first problem
+    int    depth = 0;           // variation nesting
+    int    ply = 0;
+    size_t game_offset = 0;
+    for(;;)
+    {
+        bool more = tz.Next(tok);
+        bool starts_game = false;
+        if( more && tok.type==PGN_TOKEN_TAG )
+            starts_game = movetext || complete;
+        else if( more && tok.type!=PGN_TOKEN_COMMENT )
+            starts_game = complete;     // eg a game without tags after a game's result
+        if( in_game && (!more || starts_game) )
+        {
+            if( !complete && !failed )
+                AddProblem( b, game_offset, ply, "truncated", movetext ? "no result" : "no moves" );
+            b.nbr_games++;
+            b.nbr_plies += ply;
+            in_game = false;
+        }
+        if( !more )
+            break;
+        if( tok.type==PGN_TOKEN_COMMENT && !in_game )
+            continue;   // eg a file comment before the first game
+        if( !in_game )
+        {
+            in_game = true;
+            movetext = complete = failed = false;
+            depth = ply = 0;
+            game_offset = b.begin + tok.offset;
+            cr = thc::ChessRules();     // ChessRules::Init() leaves the board alone
+        }
+        switch( tok.type )
+        {
+            case PGN_TOKEN_TAG:
+            {
+                std::string fen;
+                if( !failed && PgnTagValue(tok,"FEN",fen) && !cr.Forsyth(fen.c_str()) )
+                {
+                    AddProblem( b, game_offset, 0, "bad_fen", fen );
+                    failed = true;
+                }
+                break;
+            }
+            case PGN_TOKEN_VARIATION_START:
+                movetext = true;
+                depth++;
+                break;
+            case PGN_TOKEN_VARIATION_END:
+                movetext = true;
+                if( depth > 0 )
+                    depth--;
+                break;
+            case PGN_TOKEN_RESULT:
+                movetext = true;
+                if( depth == 0 )
+                    complete = true;
+                break;
+            case PGN_TOKEN_SAN:
+            {
+                movetext = true;
+                if( depth>0 || failed )
+                    break;
+                thc::Move mv;
+                if( !BitboardNaturalIn( mv, &cr, tok.txt ) )
+                {
+                    AddProblem( b, game_offset, ply+1, "illegal", tok.txt );
+                    failed = true;
+                }
+                else
+                {
+                    cr.PlayMove(mv);
+                    ply++;
+                }
+                break;
+            }
+            case PGN_TOKEN_GLYPH:
+                movetext = true;
+                if( depth==0 && !failed && 0==strcmp(tok.txt,"--") )
+                {
+                    AddProblem( b, game_offset, ply+1, "null_move" );
+                    failed = true;
+                }
+                break;
+            default:
+                movetext = true;
+                break;
+        }
+    }
+}
+
+// The main thread just finds game boundaries about every VALIDATE_PGN_CHUNK bytes,
+//  the workers do all the tokenising and replaying
+static void PgnProduce( const char *data, size_t len, BatchQueue &queue )
+{
+    size_t begin = 0;
+    while( begin < len )
+    {
+        size_t end = len;
+        if( len-begin > VALIDATE_PGN_CHUNK )
+            end = PgnNextGame( data, len, begin+VALIDATE_PGN_CHUNK );
+        Batch b;
+        b.begin = begin;
+        b.end = end;
+        b.nbr_games = 0;
+        b.nbr_plies = 0;
+        queue.Push(b);
+        begin = end;
+    }
+}
+
+/****************************************************************************
+ * .tdb
+ ****************************************************************************/
+
+struct TdbLayout
+{
+    size_t   first_game;    // offset of the first game header
+    size_t   game_hdr_len;  // bytes of bit packed header before each game's moves
+    uint64_t nbr_games;     // according to the file header
+};
+
+static bool TdbOpen( const char *data, size_t len, TdbLayout &layout, std::string &error )
+{
+    if( len<TDB_COMPATIBILITY_HEADER_SIZE || 0!=memcmp(data+0x100,"TDB format",10) )
+    {
+        error = "not a .tdb file";
+        return false;
+    }
+    uint32_t compatibility_header_size;
+    memcpy( &compatibility_header_size, data+0x0f0, sizeof(compatibility_header_size) );
+    if( compatibility_header_size<0x10b || compatibility_header_size>TDB_COMPATIBILITY_HEADER_SIZE )
+        compatibility_header_size = TDB_COMPATIBILITY_HEADER_SIZE;
+    int version = static_cast<unsigned char>( data[compatibility_header_size-1] );
+    if( version!=DATABASE_VERSION_NUMBER_BIN_DB && version!=DATABASE_VERSION_NUMBER_LOCKABLE )
+    {
+        error = "unsupported .tdb version";
+        return false;
+    }
+    TdbFileHeader fh;
+    memset( &fh, 0, sizeof(fh) );
+    if( len < compatibility_header_size+5*sizeof(int32_t) )
+    {
+        error = "truncated file header";
+        return false;
+    }
+    memcpy( &fh, data+compatibility_header_size, len-compatibility_header_size<sizeof(fh) ? len-compatibility_header_size : sizeof(fh) );
+    if( fh.hdr_len<0 || fh.nbr_players<0 || fh.nbr_events<0 || fh.nbr_sites<0 || fh.nbr_games<0 )
+    {
+        error = "corrupt file header";
+        return false;
+    }
+    size_t posn = compatibility_header_size + fh.hdr_len;
+    int64_t nbr_strings = static_cast<int64_t>(fh.nbr_players) + fh.nbr_events + fh.nbr_sites;
+    for( int64_t i=0; i<nbr_strings; i++ )
+    {
+        const char *nul = posn<len ? static_cast<const char *>( memchr( data+posn, '\0', len-posn ) ) : NULL;
+        if( !nul )
+        {
+            error = "truncated string table";
+            return false;
+        }
+        posn = (nul-data) + 1;
+    }
+    int bits = BitsRequired(fh.nbr_events) + BitsRequired(fh.nbr_sites) + 2*BitsRequired(fh.nbr_players)
+             + 19 + 16 + 9 + 2 + 12 + 12;   // date, round, ECO, result and the two Elos, see BinDbLoadAllGames()
+    layout.first_game = posn;
+    layout.game_hdr_len = (bits+7)/8;
+    layout.nbr_games = fh.nbr_games;
+    return true;
+}
+
+// Replay every game in a .tdb batch, the moves are always from the standard position.
+//  CompressMoves decodes onto its own thc::ChessRules, in fast mode without checking
+//  legality, so each move is checked against the bitboard legal move list (which,
+//  unlike the decoder's slow mode, tracks the real castling rights)
+static void TdbValidate( const char *data, const TdbLayout &layout, Batch &b )
+{
+    thc::ChessPosition start;
+    thc::Move legal[MAXMOVES];
+    for( size_t i=0; i<b.games.size(); i++ )
+    {
+        size_t offset = b.games[i];
+        const char *moves = data + offset + layout.game_hdr_len;
+        const char *end = (i+1<b.games.size() ? data+b.games[i+1] : data+b.end);
+        bool terminated = (end>moves && end[-1]=='\0');
+        size_t len = (end>moves ? end-moves : 0) - (terminated?1:0);
+        if( !terminated )
+            AddProblem( b, offset, 0, "truncated", "no moves terminator" );
+        CompressMoves press;
+        BitboardPosition bb(start);
+        int ply;
+        for( ply=0; ply<static_cast<int>(len); ply++ )
+        {
+            thc::Move mv = press.UncompressMove( moves[ply] );
+            int nbr_legal = bb.GenLegalMoveList( legal );
+            int j;
+            for( j=0; j<nbr_legal && legal[j]!=mv; j++ )
+                ;
+            if( j == nbr_legal )
+            {
+                char buf[16];
+                sprintf( buf, "code 0x%02x", static_cast<unsigned char>(moves[ply]) );
+                AddProblem( b, offset, ply+1, "illegal", buf );
+                break;
+            }
+            bb.PlayMove(mv);
+        }
+        b.nbr_games++;
+        b.nbr_plies += ply;
+    }
+}
+
+// The main thread walks the chain of headers and '\0' terminators, the workers
+//  decode and replay
+static void TdbProduce( const char *data, size_t len, const TdbLayout &layout, BatchQueue &queue, std::vector<Problem> &problems )
+{
+    size_t posn = layout.first_game;
+    uint64_t nbr_games = 0;
+    while( nbr_games<layout.nbr_games && posn<len )
+    {
+        Batch b;
+        b.begin = posn;
+        b.nbr_games = 0;
+        b.nbr_plies = 0;
+        while( b.games.size()<VALIDATE_TDB_BATCH && nbr_games<layout.nbr_games && posn<len )
+        {
+            b.games.push_back(posn);
+            nbr_games++;
+            size_t moves = posn + layout.game_hdr_len;
+            const char *nul = moves<len ? static_cast<const char *>( memchr( data+moves, '\0', len-moves ) ) : NULL;
+            posn = nul ? (nul-data)+1 : len;
+        }
+        b.end = posn;
+        queue.Push(b);
+    }
+    if( nbr_games < layout.nbr_games )
+    {
+        Problem p;
+        p.offset = len;
+        p.game = nbr_games+1;
+        p.ply = 0;
+        p.reason = "truncated";
+        char buf[80];
+        sprintf( buf, "file ends after %llu of %llu games", static_cast<unsigned long long>(nbr_games), static_cast<unsigned long long>(layout.nbr_games) );
+        p.detail = buf;
+        problems.push_back(p);
+    }
+    else if( posn < len )
+    {
+        Problem p;
+        p.offset = posn;
+        p.game = nbr_games;
+        p.ply = 0;
+        p.reason = "trailing_data";
+        char buf[40];
+        sprintf( buf, "%llu bytes", static_cast<unsigned long long>(len-posn) );
+        p.detail = buf;
+        problems.push_back(p);
+    }
+}
+
+/****************************************************************************
+ * Main
+ ****************************************************************************/
+
+static bool HasExtension( const char *filename, const char *ext )
+{
+    size_t len = strlen(filename);
+    size_t ext_len = strlen(ext);
+    if( len < ext_len )
+        return false;
+    const char *p = filename + len - ext_len;
+    for( size_t i=0; i<ext_len; i++ )
+    {
+        if( tolower(static_cast<unsigned char>(p[i])) != ext[i] )
+            return false;
+    }
+    return true;
+}
+
+int main( int argc, char *argv[] )
+{
+    int nbr_threads = 0;
+    const char *in_name = NULL;
+    const char *report_name = NULL;
+    for( int i=1; i<argc; i++ )
+    {
+        if( 0==strcmp(argv[i],"-t") && i+1<argc )
+            nbr_threads = atoi(argv[++i]);
+        else if( 0==strcmp(argv[i],"-o") && i+1<argc )
+            report_name = argv[++i];
+        else if( !in_name && argv[i][0]!='-' )
+            in_name = argv[i];
+        else
+        {
+            in_name = NULL;
+            break;
+        }
+    }
+    if( !in_name )
+    {
+        fprintf( stderr, "usage: tarrasch-validate [-t threads] [-o report.tsv] file.pgn|file.tdb\n" );
+        return 2;
+    }
+    if( nbr_threads < 1 )
+        nbr_threads = std::thread::hardware_concurrency();
+    if( nbr_threads < 1 )
+        nbr_threads = 1;
+    FILE *fin = fopen( in_name, "rb" );
+    if( !fin )
+    {
+        fprintf( stderr, "Cannot open %s\n", in_name );
+        return 2;
+    }
+    FILE *report = stdout;
+    if( report_name )
+    {
+        report = fopen( report_name, "wt" );
+        if( !report )
+        {
+            fprintf( stderr, "Cannot open %s\n", report_name );
+            fclose(fin);
+            return 2;
+        }
+    }
+    extern void compress_temp_lookup_gen_function();
+    compress_temp_lookup_gen_function();
+    auto t0 = std::chrono::steady_clock::now();
+    PgnMappedFile file;
+    file.Open(fin);
+    const char *data = file.Data();
+    size_t len = file.Length();
+    bool tdb = HasExtension(in_name,".tdb");
+    TdbLayout layout;
+    if( tdb )
+    {
+        std::string error;
+        if( !TdbOpen( data, len, layout, error ) )
+        {
+            fprintf( stderr, "%s: %s\n", in_name, error.c_str() );
+            fclose(fin);
+            if( report_name )
+                fclose(report);
+            return 2;
+        }
+    }
+
+    // The main thread feeds batches to the workers
+    BatchQueue queue;
+    std::vector<Problem> file_problems;
+    auto worker = [&]()
+    {
+        Batch *b;
+        while( NULL != (b=queue.Pop()) )
+        {
+            if( tdb )
+                TdbValidate( data, layout, *b );
+            else
+                PgnValidate( data, *b );
+        }
+    };
+    std::vector<std::thread> pool;
+    for( int i=0; i<nbr_threads; i++ )
+        pool.push_back( std::thread(worker) );
+    if( tdb )
+        TdbProduce( data, len, layout, queue, file_problems );
+    else
+        PgnProduce( data, len, queue );
+    queue.Finish();
+    for( std::thread &t: pool )
+        t.join();
+    double secs = std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
+
+    // One tab separated line per problem, in file order
+    fprintf( report, "offset\tgame\tply\treason\tdetail\n" );
+    uint64_t nbr_games = 0;
+    uint64_t nbr_plies = 0;
+    uint64_t nbr_bad = 0;
+    for( Batch &b: queue.batches )
+    {
+        for( Problem &p: b.problems )
+        {
+            p.game += nbr_games+1;
+            fprintf( report, "%llu\t%llu\t%d\t%s\t%s\n", static_cast<unsigned long long>(p.offset), static_cast<unsigned long long>(p.game), p.ply, p.reason, p.detail.c_str() );
+            nbr_bad++;
+        }
+        nbr_games += b.nbr_games;
+        nbr_plies += b.nbr_plies;
+    }
+    for( Problem &p: file_problems )
+    {
+        fprintf( report, "%llu\t%llu\t%d\t%s\t%s\n", static_cast<unsigned long long>(p.offset), static_cast<unsigned long long>(p.game), p.ply, p.reason, p.detail.c_str() );
+        nbr_bad++;
+    }
+    if( report_name )
+        fclose(report);
+    fclose(fin);
+    fprintf( stderr, "%s: %llu games, %llu plies, %llu problems, %d threads, %.3f secs (%.0f games/s, %.1f MB/s)\n",
+             in_name, static_cast<unsigned long long>(nbr_games), static_cast<unsigned long long>(nbr_plies),
+             static_cast<unsigned long long>(nbr_bad), nbr_threads, secs,
+             secs>0.0 ? nbr_games/secs : 0.0, secs>0.0 ? len/secs/1000000.0 : 0.0 );
+    return nbr_bad ? 1 : 0;
+}